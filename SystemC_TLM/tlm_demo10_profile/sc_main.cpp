@@ -0,0 +1,79 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo10_profile/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo10 (host profiling)
+ *
+ * Usage: tlm_demo10_profile [ns] [flat file] [collapsed file]
+ *
+ * Runs the temporal decoupling platform of TLM_demo3 with the host profiler
+ * compiled in. The collapsed stacks can be rendered with flamegraph.pl.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo3_decop/processor0.h"
+#include "../tlm_demo3_decop/processor1.h"
+#include "../tlm_demo3_sync/bus.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo10
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    double      t_sim     = (argc > 1) ? atof(argv[1]) : 10000; // in ns
+    const char* flat      = (argc > 2) ? argv[2] : "profile.txt";
+    const char* collapsed = (argc > 3) ? argv[3] : "profile.folded";
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(20, sc_core::SC_NS ));
+    
+    //! Instantiate the modules
+    processor0   *i_cpu0 = new processor0("i_cpu0");
+    processor1   *i_cpu1 = new processor1("i_cpu1");
+    memory       *i_mem  = new memory("i_memory", false);
+    bus          *i_bus  = new bus("i_bus");
+
+    //! Bind  the TLM ports
+    i_cpu0->data_bus.bind( i_bus->data_bus0 );
+    i_cpu1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    host_profiler &profiler = host_profiler::instance();
+    
+    int t_start=clock();
+    profiler.start();
+    sc_start(t_sim, sc_core::SC_NS);
+    profiler.stop();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    profiler.write_flat(cout);
+    if (!profiler.write(flat, collapsed))
+    {
+        cerr << "Error: cannot write " << flat << " or " << collapsed << endl;
+    }
+
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 10 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,215 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo11_microbench/bench_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Micro-benchmarks of the model hot paths
+ *
+ * Usage: tlm_demo11_microbench [calls per run] [runs] [filter]
+ *
+ * Calls the b_transport callbacks of memory, target and bus directly from
+ * sc_main with prepared payloads, while the simulation is paused after the
+ * elaboration. Only the processor::bus_readwrite cases run in a thread, since
+ * they wait. Prints the minimum and median host time per call over the runs.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <sstream>
+#include "../tlm_demo1/target.h"
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/reg_bank.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "micro_bench.h"
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+//! Stream buffer discarding all output, to silence the target logging.
+//------------------------------------------------------------------------------
+class null_buffer : public streambuf
+{
+protected:
+    int overflow(int c) { return c; }
+};
+
+
+// -----------------------------------------------------------------------------
+//! main program to execute the TLM_demo11 micro-benchmarks
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    bench_config cfg;
+    cfg.calls  = (argc > 1) ? atol(argv[1]) : 1000000;
+    cfg.runs   = (argc > 2) ? atoi(argv[2]) : 5;
+    cfg.filter = (argc > 3) ? argv[3] : "";
+
+    //! Instantiate and bind the modules, the console output is disabled
+    memory          *i_mem    = new memory("i_memory", false);
+    bench_initiator *i_to_mem = new bench_initiator("i_to_mem");
+    i_to_mem->socket.bind(i_mem->data_bus);
+
+    target          *i_target = new target("i_target");
+
+    null_target     *i_null   = new null_target("i_null");
+    bus             *i_bus    = new bus("i_bus");
+    bench_initiator *i_to_bus0 = new bench_initiator("i_to_bus0");
+    bench_initiator *i_to_bus1 = new bench_initiator("i_to_bus1");
+    i_to_bus0->socket.bind(i_bus->data_bus0);
+    i_to_bus1->socket.bind(i_bus->data_bus1);
+    i_bus->initiator_socket.bind(i_null->socket);
+
+    // 64 registers, the write callback as a peripheral would have one
+    reg_bank        *i_regs   = new reg_bank("i_regs", 0x100);
+    bench_initiator *i_to_regs = new bench_initiator("i_to_regs");
+    uint32_t         reg_writes = 0;
+    for (uint32_t offset = 0; offset < 0x100; offset += 4)
+    {
+        i_regs->add_register(offset, 4, 0, 0xFFFFFFFF, reg_bank::read_callback(),
+                             [&reg_writes](uint32_t, sc_core::sc_time&) { reg_writes++; });
+    }
+    i_to_regs->socket.bind(i_regs->reg_bus);
+
+    memory          *i_mem_p  = new memory("i_memory_p", false);
+    bus             *i_bus_p  = new bus("i_bus_p");
+    bench_processor *i_cpu    = new bench_processor("i_cpu", cfg);
+    bench_initiator *i_idle   = new bench_initiator("i_idle");
+    i_cpu->data_bus.bind(i_bus_p->data_bus0);
+    i_idle->socket.bind(i_bus_p->data_bus1);
+    i_bus_p->initiator_socket.bind(i_mem_p->data_bus);
+
+    // elaborate and initialize, the sockets are only bound afterwards
+    sc_core::sc_start(sc_core::SC_ZERO_TIME);
+
+    cout << setw(40) << left << "case" << right
+         << setw(12) << "min ns" << setw(12) << "median ns" << endl;
+
+    tlm::tlm_generic_payload trans;
+    sc_core::sc_time         delay;
+    uint32_t                 data = 0;
+    uint32_t                 be   = 0;
+
+    unsigned char* data_ptr = reinterpret_cast<unsigned char*>(&data);
+    unsigned char* be_ptr   = reinterpret_cast<unsigned char*>(&be);
+
+    //! memory::bus_readwrite through its target socket, up to a word, a
+    //! longer access would only time the error response
+    const tlm::tlm_command cmds[]      = { tlm::TLM_READ_COMMAND, tlm::TLM_WRITE_COMMAND };
+    const char*            cmd_names[] = { "read", "write" };
+    const unsigned int     sizes[]     = { 1, 2, 4 };
+    const uint32_t         be_masks[]  = { 0, 0xFFFFFFFF, 0x00FF00FF };
+    const char*            be_names[]  = { "none", "all", "partial" };
+
+    for (int c = 0; c < 2; c++)
+    {
+        for (int s = 0; s < 3; s++)
+        {
+            for (int b = 0; b < 3; b++)
+            {
+                ostringstream name;
+                name << "memory/" << cmd_names[c] << "/" << sizes[s] << "B/be="
+                     << be_names[b];
+
+                be = be_masks[b];
+                unsigned char* be_arg = b ? be_ptr : 0;
+
+                bench_case(cfg, name.str(), [&]() {
+                    bench_payload(trans, cmds[c], 0x10, sizes[s], data_ptr, be_arg);
+                    delay = sc_core::SC_ZERO_TIME;
+                    i_to_mem->socket->b_transport(trans, delay);
+                });
+            }
+        }
+    }
+
+    //! 16 scattered words in one scatter-gather transaction, memory and bus
+    uint32_t     words[16];
+    sg_extension sg;
+    for (int i = 0; i < 16; i++)
+    {
+        sg.add(0x40 + 12 * i, 4, reinterpret_cast<unsigned char*>(&words[i]));
+    }
+
+    for (int c = 0; c < 2; c++)
+    {
+        string name = string("memory/") + cmd_names[c] + "/16x4B/sg";
+
+        bench_case(cfg, name, [&]() {
+            sg.command  = cmds[c];
+            sg.executed = false;
+            bench_payload(trans, tlm::TLM_IGNORE_COMMAND, 0x40, 0, 0, 0);
+            trans.set_extension(&sg);
+            delay = sc_core::SC_ZERO_TIME;
+            i_to_mem->socket->b_transport(trans, delay);
+            trans.clear_extension(&sg);
+        });
+    }
+
+    // the null target does not know the extension, the bus splits it
+    bench_case(cfg, "bus0/read/16x4B/sg-fallback", [&]() {
+        sg.command  = tlm::TLM_READ_COMMAND;
+        sg.executed = false;
+        bench_payload(trans, tlm::TLM_IGNORE_COMMAND, 0x40, 0, 0, 0);
+        trans.set_extension(&sg);
+        delay = sc_core::SC_ZERO_TIME;
+        i_to_bus0->socket->b_transport(trans, delay);
+        trans.clear_extension(&sg);
+    });
+
+    //! target::b_transport of tlm_demo1, including its console logging
+    //! formatted into the null buffer, the result goes to the console
+    streambuf*  cout_buf = cout.rdbuf();
+    null_buffer discard;
+    ostream     console(cout_buf);
+    cout.rdbuf(&discard);
+    for (int c = 0; c < 2; c++)
+    {
+        string name = string("target/") + cmd_names[c] + "/4B/be=none";
+
+        bench_case(cfg, name, [&]() {
+            bench_payload(trans, cmds[c], 0x10, 4, data_ptr, 0);
+            delay = sc_core::SC_ZERO_TIME;
+            i_target->b_transport(trans, delay);
+        }, console);
+    }
+    cout.rdbuf(cout_buf);
+
+    //! bus forwarding to a target doing nothing, on both bus target sockets
+    bench_initiator* bus_ports[] = { i_to_bus0, i_to_bus1 };
+    for (int p = 0; p < 2; p++)
+    {
+        for (int c = 0; c < 2; c++)
+        {
+            ostringstream name;
+            name << "bus" << p << "/" << cmd_names[c] << "/4B/be=none";
+
+            bench_case(cfg, name.str(), [&]() {
+                bench_payload(trans, cmds[c], 0x10, 4, data_ptr, 0);
+                delay = sc_core::SC_ZERO_TIME;
+                bus_ports[p]->socket->b_transport(trans, delay);
+            });
+        }
+    }
+
+    //! register bank dispatch, compare with the memory cases
+    for (int c = 0; c < 2; c++)
+    {
+        string name = string("reg_bank/") + cmd_names[c] + "/4B/be=none";
+
+        bench_case(cfg, name, [&]() {
+            bench_payload(trans, cmds[c], 0xC4, 4, data_ptr, 0);
+            delay = sc_core::SC_ZERO_TIME;
+            i_to_regs->socket->b_transport(trans, delay);
+        });
+    }
+
+    //! processor::bus_readwrite through bus and memory, runs in a thread
+    i_cpu->start.notify(sc_core::SC_ZERO_TIME);
+    sc_core::sc_start();
+
+    return 0;
+}
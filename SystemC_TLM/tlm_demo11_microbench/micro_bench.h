@@ -0,0 +1,217 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo11_microbench/micro_bench.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Micro-benchmark harness and helper modules
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo11_micro_bench_h_
+#define _tlm_demo11_micro_bench_h_
+
+#include <chrono>
+#include <vector>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "../tlm_demo2/processor.h"
+
+
+//------------------------------------------------------------------------------
+//! Settings of a benchmark run.
+//------------------------------------------------------------------------------
+struct bench_config
+{
+    unsigned long  calls;    //!< Calls per repetition
+    int            runs;     //!< Repetitions per case
+    std::string    filter;   //!< Only run the cases containing this string
+};
+
+
+//------------------------------------------------------------------------------
+//! Runs one benchmark case and prints the host time per call.
+//
+//! The case is warmed up with a tenth of the calls, then repeated
+//! bench_config::runs times. The minimum over the repetitions is the value to
+//! compare across commits, the median shows how noisy the host was.
+//
+//! @param cfg   Benchmark settings
+//! @param name  Case name, "component/command/size/byte enables"
+//! @param f     Function performing one call
+//! @param out   Stream of the result, e.g. while std::cout is silenced
+//------------------------------------------------------------------------------
+template <class F>
+void bench_case(const bench_config& cfg, const std::string& name, F f,
+                std::ostream& out = std::cout)
+{
+    if (name.find(cfg.filter) == std::string::npos) return;
+
+    typedef std::chrono::steady_clock clock_type;
+
+    for (unsigned long i = 0; i < cfg.calls / 10 + 1; i++) f();
+
+    std::vector<double> ns;
+    for (int r = 0; r < cfg.runs; r++)
+    {
+        clock_type::time_point t0 = clock_type::now();
+        for (unsigned long i = 0; i < cfg.calls; i++) f();
+        clock_type::time_point t1 = clock_type::now();
+
+        ns.push_back(std::chrono::duration<double, std::nano>(t1 - t0).count()
+                     / cfg.calls);
+    }
+    std::sort(ns.begin(), ns.end());
+
+    out << std::setw(40) << std::left << name << std::right
+        << std::fixed << std::setprecision(1)
+        << std::setw(12) << ns[0]
+        << std::setw(12) << ns[ns.size() / 2] << std::endl;
+}
+
+
+//------------------------------------------------------------------------------
+//! Prepares a payload for a benchmark case.
+//
+//! @param trans  The payload
+//! @param cmd    The TLM command
+//! @param addr   The address
+//! @param len    The data length
+//! @param data   The data buffer, at least 4 bytes
+//! @param be     The byte enable buffer, 0 for none
+//------------------------------------------------------------------------------
+inline void bench_payload(tlm::tlm_generic_payload& trans, tlm::tlm_command cmd,
+                          sc_dt::uint64 addr, unsigned int len,
+                          unsigned char* data, unsigned char* be)
+{
+    trans.set_command(cmd);
+    trans.set_address(addr);
+    trans.set_data_ptr(data);
+    trans.set_data_length(len);
+    trans.set_streaming_width(len);
+    trans.set_byte_enable_ptr(be);
+    trans.set_byte_enable_length(be ? 4 : 0);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+}
+
+
+//------------------------------------------------------------------------------
+//! Initiator socket holder to call b_transport from sc_main.
+//------------------------------------------------------------------------------
+SC_MODULE(bench_initiator)
+{
+    tlm_utils::simple_initiator_socket<bench_initiator> socket;
+
+    SC_CTOR(bench_initiator) : socket("socket") {}
+};
+
+
+//------------------------------------------------------------------------------
+//! Target completing every transaction without any work, to measure the
+//! forwarding cost of the bus alone.
+//------------------------------------------------------------------------------
+SC_MODULE(null_target)
+{
+    tlm_utils::simple_target_socket<null_target> socket;
+
+    SC_CTOR(null_target) : socket("socket")
+    {
+        socket.register_b_transport(this, &null_target::b_transport);
+    }
+
+    void b_transport(tlm::tlm_generic_payload& payload, sc_core::sc_time& delay)
+    {
+        payload.set_response_status( tlm::TLM_OK_RESPONSE );
+    }
+};
+
+
+//------------------------------------------------------------------------------
+//! Processor running the processor::bus_readwrite cases in its thread.
+//
+//! processor::bus_readwrite waits for the annotated delay, so these are the
+//! only cases that need the SystemC kernel. They include one context switch
+//! per call. The cases start on ::start and the simulation is stopped when
+//! they are done.
+//------------------------------------------------------------------------------
+class bench_processor : public processor
+{
+public:
+
+    //! Class Construct
+    bench_processor(sc_core::sc_module_name name, const bench_config& cfg)
+    : processor(name), cfg(cfg) {}
+
+    //! Starts the benchmark cases.
+    sc_core::sc_event start;
+
+private:
+
+    //! SystemC Thread running the benchmark cases.
+    void program_main()
+    {
+        uint32_t data    = 0;
+        uint32_t be_all  = 0xFFFFFFFF;
+
+        wait(start);
+
+        bench_case(cfg, "processor/read/4B/be=none", [&]() {
+            bus_readwrite(tlm::TLM_READ_COMMAND, 0x10, 4,
+                          reinterpret_cast<uint8_t*>(&data), 0);
+        });
+        bench_case(cfg, "processor/read/4B/be=all", [&]() {
+            bus_readwrite(tlm::TLM_READ_COMMAND, 0x10, 4,
+                          reinterpret_cast<uint8_t*>(&data),
+                          reinterpret_cast<uint8_t*>(&be_all));
+        });
+        bench_case(cfg, "processor/write/4B/be=none", [&]() {
+            bus_readwrite(tlm::TLM_WRITE_COMMAND, 0x10, 4,
+                          reinterpret_cast<uint8_t*>(&data), 0);
+        });
+        bench_case(cfg, "processor/write/4B/be=all", [&]() {
+            bus_readwrite(tlm::TLM_WRITE_COMMAND, 0x10, 4,
+                          reinterpret_cast<uint8_t*>(&data),
+                          reinterpret_cast<uint8_t*>(&be_all));
+        });
+
+        // 16 scattered words, per word and in one scatter-gather transaction
+        uint32_t words[16];
+        sg_extension sg;
+        for (int i = 0; i < 16; i++)
+        {
+            sg.add(0x40 + 12 * i, 4, reinterpret_cast<uint8_t*>(&words[i]));
+        }
+
+        bench_case(cfg, "processor/read/16x4B/single", [&]() {
+            for (int i = 0; i < 16; i++)
+            {
+                bus_readwrite(tlm::TLM_READ_COMMAND, 0x40 + 12 * i, 4,
+                              reinterpret_cast<uint8_t*>(&words[i]), 0);
+            }
+        });
+        bench_case(cfg, "processor/read/16x4B/sg", [&]() {
+            sg.command = tlm::TLM_READ_COMMAND;
+            bus_scatter_gather(sg);
+        });
+        bench_case(cfg, "processor/write/16x4B/sg", [&]() {
+            sg.command = tlm::TLM_WRITE_COMMAND;
+            bus_scatter_gather(sg);
+        });
+
+        sc_core::sc_stop();
+    }
+
+    //! Benchmark settings.
+    bench_config cfg;
+};
+
+#endif
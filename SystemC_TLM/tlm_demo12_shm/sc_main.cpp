@@ -0,0 +1,85 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo12_shm/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo12 (shared memory backing)
+ *
+ * Usage: tlm_demo12_shm [shared memory name] [transactions]
+ *
+ * Two traffic generators write to a memory whose storage is a named shared
+ * memory object. Run tlm_demo12_monitor with the same name alongside to
+ * watch the memory contents while the simulation runs.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo12
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    const char* shm_name = (argc > 1) ? argv[1] : "/vp_memory";
+    
+    traffic_config config;
+    config.pattern        = PATTERN_RANDOM;
+    config.base_addr      = 0xFF000000;
+    config.range          = 256;
+    config.read_ratio     = 0.5;
+    config.access_size    = 4;
+    config.issue_interval = sc_core::sc_time(10, sc_core::SC_NS);
+    config.n_transactions = (argc > 2) ? atoll(argv[2]) : 10000000;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    //! Instantiate the modules
+    traffic_generator *i_gen0 = new traffic_generator("i_gen0", config);
+    config.seed = 2;
+    traffic_generator *i_gen1 = new traffic_generator("i_gen1", config);
+    memory            *i_mem  = new memory("i_memory", false);
+    bus               *i_bus  = new bus("i_bus");
+    
+    //! Bind  the TLM ports
+    i_gen0->data_bus.bind( i_bus->data_bus0 );
+    i_gen1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    //! Move the memory storage into the shared memory
+    if (!i_mem->map_shared(shm_name)) return 1;
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    uint64_t n_trans = i_gen0->get_transactions() + i_gen1->get_transactions();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 12 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Shared memory    : " << setw(20) << setfill(' ') << shm_name <<"   #"<<endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << n_trans   <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e6 <<" us          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
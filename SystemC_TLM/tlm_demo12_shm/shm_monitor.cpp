@@ -0,0 +1,82 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo12_shm/shm_monitor.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Stand-alone monitor of a shared memory of the memory module
+ *
+ * Usage: tlm_demo12_monitor [shared memory name] [interval in ms] [bytes]
+ *                           [number of polls]
+ *
+ * Maps the memory contents read-only and prints a snapshot whenever the
+ * generation changed. The simulation does not take part in this at all. The
+ * monitor stops after the given number of polls, or on Ctrl-C if it is zero.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../tlm_demo2/memory_shm.h"
+
+using namespace std;
+
+//! Set by SIGINT or SIGTERM, ends the polling loop.
+static volatile sig_atomic_t stop = 0;
+
+static void on_signal(int) { stop = 1; }
+
+// -----------------------------------------------------------------------------
+//! main program of the monitor
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    const char* shm_name = (argc > 1) ? argv[1] : "/vp_memory";
+    int         interval = (argc > 2) ? atoi(argv[2]) : 500;  // in ms
+    uint64_t    n_bytes  = (argc > 3) ? atoll(argv[3]) : 64;
+    uint64_t    n_polls  = (argc > 4) ? atoll(argv[4]) : 0;   // 0 for no limit
+    
+    signal(SIGINT,  on_signal);
+    signal(SIGTERM, on_signal);
+    
+    const memory_shm_header* hdr = 0;
+    while ((hdr = memory_shm_attach(shm_name)) == 0)
+    {
+        if (stop) return 0;
+        cerr << "waiting for " << shm_name << endl;
+        sleep(1);
+    }
+    
+    cout << string(hdr->model) << ": " << hdr->size << " bytes" << endl;
+    if (n_bytes > hdr->size) n_bytes = hdr->size;
+    
+    vector<uint8_t> snapshot(n_bytes);
+    uint64_t last = ~uint64_t(0);
+    
+    for (uint64_t poll = 0; !stop && (n_polls == 0 || poll < n_polls); poll++)
+    {
+        uint64_t gen = memory_shm_read(hdr, 0, &snapshot[0], n_bytes);
+        if (gen != last)
+        {
+            cout << "generation " << dec << gen / 2 << " writes" << endl;
+            for (uint64_t i = 0; i < n_bytes; i++)
+            {
+                if (i % 16 == 0) cout << "  0x" << hex << setw(8) << setfill('0') << i << ":";
+                cout << " " << hex << setw(2) << setfill('0') << int(snapshot[i]);
+                if (i % 16 == 15 || i + 1 == n_bytes) cout << endl;
+            }
+            last = gen;
+        }
+        usleep(interval * 1000);
+    }
+    
+    memory_shm_detach(hdr);
+    return 0;
+}
@@ -0,0 +1,373 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo13_remote/remote_bridge.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Bridge target module to a remote model, implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "remote_bridge.h"
+
+#include <math.h>
+#include <string.h>
+#include <sys/un.h>
+
+SC_HAS_PROCESS( remote_bridge );
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the remote bridge
+//
+//! @param name         SystemC module name
+//! @param socket_path  Unix domain socket the peer listens on
+//! @param max_batch    Maximal number of transactions per message
+//------------------------------------------------------------------------------
+remote_bridge::remote_bridge(sc_module_name      name,
+                             const std::string&  socket_path,
+                             unsigned int        max_batch) :
+sc_module (name), data_bus("data_bus"), latency(5, SC_NS),
+socket_path(socket_path), max_batch(max_batch ? max_batch : 1), fd(-1),
+n_pending(0), seq(0),
+n_transactions(0), n_messages(0), n_round_trips(0), n_errors(0)
+{
+    data_bus.register_b_transport(this, &remote_bridge::bus_readwrite);
+    data_bus.register_transport_dbg(this, &remote_bridge::debug_transport);
+
+    batch.reserve(sizeof(remote_header) + this->max_batch * (sizeof(remote_request) + 8));
+    batch.resize(sizeof(remote_header));
+
+    SC_METHOD(quantum_flush);
+    sensitive << flush_event;
+    dont_initialize();
+}
+
+
+remote_bridge::~remote_bridge()
+{
+    if (fd >= 0) close(fd);
+}
+
+
+//------------------------------------------------------------------------------
+//! Connects to the peer, which may still be starting up.
+//------------------------------------------------------------------------------
+void remote_bridge::start_of_simulation()
+{
+    struct sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strncpy(sa.sun_path, socket_path.c_str(), sizeof(sa.sun_path) - 1);
+
+    for (int retry = 0; retry < 50; retry++)
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr*) &sa, sizeof(sa)) == 0) return;
+
+        if (fd >= 0) close(fd);
+        fd = -1;
+        usleep(100000);
+    }
+
+    SC_REPORT_ERROR("remote_bridge", ("can not connect to " + socket_path).c_str());
+}
+
+
+//------------------------------------------------------------------------------
+//! Sends the pending writes and waits until the peer executed everything.
+//------------------------------------------------------------------------------
+void remote_bridge::end_of_simulation()
+{
+    if (fd < 0) return;
+
+    send_batch();
+    if (!flight.empty()) n_round_trips++;
+    while (!flight.empty() && fd >= 0) collect();
+}
+
+
+//------------------------------------------------------------------------------
+//! Sends the current batch at the end of its global quantum.
+//------------------------------------------------------------------------------
+void remote_bridge::quantum_flush()
+{
+    send_batch();
+}
+
+
+//------------------------------------------------------------------------------
+//! Appends a transaction to the current batch.
+//
+//! The first transaction of a batch defines the quantum of the batch, the
+//! batch is sent at the latest at the end of this quantum.
+//
+//! @param payload  The generic TLM payload
+//! @param flags    remote_flags of the transaction
+//! @param t        Time the transaction is issued at, including the offset
+//
+//! @return False if the transaction is not supported, the response is set
+//------------------------------------------------------------------------------
+bool remote_bridge::append(tlm::tlm_generic_payload& payload, uint8_t flags,
+                           const sc_time& t)
+{
+    tlm::tlm_command cmd = payload.get_command();
+    unsigned int length  = payload.get_data_length();
+    unsigned int be_len  = 0;
+
+    // byte enables without a length cover the data, as in the memory
+    if (payload.get_byte_enable_ptr() && !(flags & REMOTE_FLAG_DEBUG))
+    {
+        be_len = payload.get_byte_enable_length();
+        if (be_len == 0) be_len = length;
+    }
+
+    if (cmd == tlm::TLM_IGNORE_COMMAND || be_len > 0xFFFF ||
+        (!(flags & REMOTE_FLAG_DEBUG) && payload.get_streaming_width() < length))
+    {
+        payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+        return false;
+    }
+
+    if (n_pending == 0)
+    {
+        sc_time quantum = tlm::tlm_global_quantum::instance().get();
+        boundary = (quantum == SC_ZERO_TIME) ? t :
+                   quantum * (floor(t / quantum) + 1);
+        flush_event.notify(boundary - sc_time_stamp());
+    }
+
+    remote_request req;
+    req.cmd       = (cmd == tlm::TLM_WRITE_COMMAND) ? REMOTE_WRITE : REMOTE_READ;
+    req.flags     = flags;
+    req.be_length = be_len;
+    req.length    = length;
+    req.addr      = payload.get_address();
+
+    const uint8_t* p = reinterpret_cast<const uint8_t*>(&req);
+    batch.insert(batch.end(), p, p + sizeof(req));
+    if (req.cmd == REMOTE_WRITE)
+    {
+        batch.insert(batch.end(), payload.get_data_ptr(),
+                     payload.get_data_ptr() + length);
+    }
+    if (be_len)
+    {
+        batch.insert(batch.end(), payload.get_byte_enable_ptr(),
+                     payload.get_byte_enable_ptr() + be_len);
+    }
+
+    n_pending++;
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//! Sends the current batch without waiting for its response.
+//
+//! If the batch ends with a read or debug access, the responses of all
+//! batches in flight are collected, including the one of this batch.
+//
+//! @param last       Read or debug access at the end of the batch, or zero
+//! @param dbg_bytes  Receives the result of a debug access, or zero
+//------------------------------------------------------------------------------
+void remote_bridge::send_batch(tlm::tlm_generic_payload* last, unsigned int* dbg_bytes)
+{
+    if (n_pending == 0 || fd < 0) return;
+
+    flush_event.cancel();
+
+    remote_header hdr;
+    hdr.magic     = REMOTE_MAGIC;
+    hdr.seq       = seq;
+    hdr.n_records = n_pending;
+    hdr.n_bytes   = batch.size() - sizeof(remote_header);
+    memcpy(&batch[0], &hdr, sizeof(hdr));
+
+    if (!remote_send(fd, &batch[0], batch.size()))
+    {
+        close(fd);
+        fd = -1;
+        SC_REPORT_ERROR("remote_bridge", "connection to the peer lost");
+        return;
+    }
+
+    in_flight f = { seq, n_pending, last, dbg_bytes };
+    flight.push_back(f);
+
+    seq++;
+    n_messages++;
+    n_pending = 0;
+    batch.resize(sizeof(remote_header));
+
+    if (last)
+    {
+        n_round_trips++;
+        while (!flight.empty() && fd >= 0) collect();
+    }
+    else if (flight.size() > MAX_IN_FLIGHT)
+    {
+        // bounds the data buffered in the socket in both directions
+        n_round_trips++;
+        collect();
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Receives the response of the oldest batch in flight.
+//------------------------------------------------------------------------------
+void remote_bridge::collect()
+{
+    in_flight f = flight.front();
+    flight.pop_front();
+
+    remote_header hdr;
+    if (!remote_recv(fd, &hdr, sizeof(hdr)) ||
+        hdr.magic != REMOTE_MAGIC || hdr.seq != f.seq || hdr.n_records != f.n_records)
+    {
+        close(fd);
+        fd = -1;
+        SC_REPORT_ERROR("remote_bridge", "invalid response from the peer");
+        return;
+    }
+
+    for (uint32_t i = 0; i < f.n_records; i++)
+    {
+        remote_response rsp;
+        if (!remote_recv(fd, &rsp, sizeof(rsp)))
+        {
+            close(fd);
+            fd = -1;
+            SC_REPORT_ERROR("remote_bridge", "connection to the peer lost");
+            return;
+        }
+
+        unsigned int n_data = (rsp.cmd == REMOTE_READ) ? rsp.length : 0;
+        if (rx.size() < n_data) rx.resize(n_data);
+        if (n_data && !remote_recv(fd, &rx[0], n_data))
+        {
+            close(fd);
+            fd = -1;
+            SC_REPORT_ERROR("remote_bridge", "connection to the peer lost");
+            return;
+        }
+
+        if (i + 1 < f.n_records || f.last == 0)
+        {
+            // posted write
+            if (rsp.status != REMOTE_OK) n_errors++;
+            continue;
+        }
+
+        tlm::tlm_generic_payload& payload = *f.last;
+
+        if (rsp.cmd == REMOTE_READ && rsp.status == REMOTE_OK)
+        {
+            unsigned char* data   = payload.get_data_ptr();
+            unsigned char* be     = payload.get_byte_enable_ptr();
+            unsigned int   be_len = payload.get_byte_enable_length();
+            unsigned int   n      = min(n_data, payload.get_data_length());
+            if (be_len == 0) be_len = n;
+
+            if (f.dbg_bytes || be == 0 || be_len == 0)
+            {
+                memcpy(data, &rx[0], n);
+            }
+            else
+            {
+                for (unsigned int k = 0; k < n; k++)
+                {
+                    if (be[k % be_len]) data[k] = rx[k];
+                }
+            }
+        }
+
+        if (f.dbg_bytes) *f.dbg_bytes = (rsp.status == REMOTE_OK) ? rsp.length : 0;
+
+        switch (rsp.status)
+        {
+            case REMOTE_OK:
+                payload.set_response_status( tlm::TLM_OK_RESPONSE );
+                break;
+            case REMOTE_ADDRESS_ERROR:
+                payload.set_response_status( tlm::TLM_ADDRESS_ERROR_RESPONSE );
+                n_errors++;
+                break;
+            case REMOTE_COMMAND_ERROR:
+                payload.set_response_status( tlm::TLM_COMMAND_ERROR_RESPONSE );
+                n_errors++;
+                break;
+            default:
+                payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+                n_errors++;
+                break;
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Blocking transport callback function, batches writes and forwards reads.
+//
+//! @param payload  The generic TLM payload
+//! @param delay    How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void remote_bridge::bus_readwrite( tlm::tlm_generic_payload& payload,
+                                   sc_time& delay )
+{
+    if (fd < 0)
+    {
+        payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+        return;
+    }
+
+    if (payload.get_command() == tlm::TLM_IGNORE_COMMAND)
+    {
+        payload.set_response_status( tlm::TLM_OK_RESPONSE );
+        return;
+    }
+
+    // a decoupled initiator may already be in the next quantum
+    sc_time t = sc_time_stamp() + delay;
+    if (n_pending && t >= boundary) send_batch();
+
+    if (!append(payload, 0, t)) return;
+    n_transactions++;
+
+    if (payload.get_command() == tlm::TLM_READ_COMMAND)
+    {
+        payload.set_response_status( tlm::TLM_INCOMPLETE_RESPONSE );
+        send_batch(&payload);
+    }
+    else
+    {
+        payload.set_response_status( tlm::TLM_OK_RESPONSE );
+        if (n_pending >= max_batch) send_batch();
+    }
+
+    delay += latency;
+}
+
+
+//------------------------------------------------------------------------------
+//! Debug transport callback function, forwards the access synchronously.
+//
+//! @param payload  The generic TLM payload
+//
+//! @return  The number of bytes transferred by the peer
+//------------------------------------------------------------------------------
+unsigned int remote_bridge::debug_transport( tlm::tlm_generic_payload& payload )
+{
+    if (fd < 0) return 0;
+
+    unsigned int n = 0;
+    if (!append(payload, REMOTE_FLAG_DEBUG, sc_time_stamp())) return 0;
+    send_batch(&payload, &n);
+    return n;
+}
@@ -0,0 +1,145 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo13_remote/remote_bridge.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Bridge target module to a remote model, definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo13_remote_bridge_h_
+#define _tlm_demo13_remote_bridge_h_
+
+#include <deque>
+#include <vector>
+#include <string>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "remote_protocol.h"
+
+
+//------------------------------------------------------------------------------
+//! Target forwarding transactions to a model in another process.
+//
+//! The transactions are sent over a Unix domain socket in batches:
+//! - Writes are posted. They are appended to the current batch and complete
+//!   immediately with an OK response.
+//! - A batch is sent when it is full, at the end of its global quantum, or
+//!   together with the next read. The response of a write-only batch is not
+//!   waited for, it is collected later (pipelining).
+//! - A read is appended to the current batch, which is sent at once. The
+//!   responses of all batches in flight are then collected, the last one
+//!   carries the read data. A read therefore costs one round trip, however
+//!   many writes preceded it.
+//
+//! Errors of posted writes are counted when their response arrives. Debug
+//! transactions are forwarded synchronously, like reads.
+//------------------------------------------------------------------------------
+class remote_bridge : public sc_core::sc_module
+{
+public:
+
+    //! Class Construct
+    remote_bridge(sc_core::sc_module_name  name,
+                  const std::string&       socket_path,
+                  unsigned int             max_batch = 256);
+
+    //! Class destructor, closes the connection.
+    ~remote_bridge();
+
+    //! TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_target_socket<remote_bridge> data_bus;
+
+    //! Delay annotated per access.
+    sc_core::sc_time latency;
+
+    //! Number of forwarded transactions.
+    sc_dt::uint64 get_transactions() const { return n_transactions; }
+
+    //! Number of sent messages.
+    sc_dt::uint64 get_messages() const { return n_messages; }
+
+    //! Number of times the simulation waited for a response.
+    sc_dt::uint64 get_round_trips() const { return n_round_trips; }
+
+    //! Number of transactions answered with an error by the peer.
+    sc_dt::uint64 get_errors() const { return n_errors; }
+
+private:
+
+    //! Maximal number of batches in flight before waiting for a response.
+    enum { MAX_IN_FLIGHT = 8 };
+
+    //! A sent batch waiting for its response.
+    struct in_flight
+    {
+        uint32_t                   seq;       //!< Sequence number
+        uint32_t                   n_records; //!< Number of transactions
+        tlm::tlm_generic_payload*  last;      //!< Read or debug access at the end
+        unsigned int*              dbg_bytes; //!< Result of a debug access
+    };
+
+    //! Connects to the peer.
+    void start_of_simulation();
+
+    //! Sends the pending writes and waits for all responses.
+    void end_of_simulation();
+
+    //! Sends the pending writes at the end of the global quantum.
+    void quantum_flush();
+
+    //! Blocking transport routine the target socket.
+    void bus_readwrite(tlm::tlm_generic_payload& payload, sc_core::sc_time& delay);
+
+    //! Debug transport routine the target socket.
+    unsigned int debug_transport(tlm::tlm_generic_payload& payload);
+
+    //! Appends a transaction issued at time t to the current batch.
+    bool append(tlm::tlm_generic_payload& payload, uint8_t flags,
+                const sc_core::sc_time& t);
+
+    //! Sends the current batch.
+    void send_batch(tlm::tlm_generic_payload* last = 0, unsigned int* dbg_bytes = 0);
+
+    //! Receives the response of the oldest batch in flight.
+    void collect();
+
+    //! Path of the Unix domain socket.
+    std::string socket_path;
+
+    //! Maximal number of transactions per batch.
+    unsigned int max_batch;
+
+    //! Socket to the peer, -1 if not connected.
+    int fd;
+
+    //! Current batch, starting with its header.
+    std::vector<uint8_t> batch;
+
+    //! Number of transactions in the current batch.
+    uint32_t n_pending;
+
+    //! End of the global quantum of the current batch.
+    sc_core::sc_time boundary;
+
+    //! Notified at ::boundary to send the current batch.
+    sc_core::sc_event flush_event;
+
+    //! Sequence number of the next batch.
+    uint32_t seq;
+
+    //! Batches sent and not yet answered, oldest first.
+    std::deque<in_flight> flight;
+
+    //! Receive buffer of read data.
+    std::vector<uint8_t> rx;
+
+    //! Statistics.
+    sc_dt::uint64 n_transactions, n_messages, n_round_trips, n_errors;
+};
+
+#endif
@@ -0,0 +1,171 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo13_remote/remote_peer.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Stand-in peer of the remote bridge
+ *
+ * Usage: tlm_demo13_peer [socket path] [memory size in bytes]
+ *
+ * A functional memory model in a separate process. It accepts one connection
+ * of a remote_bridge, executes the request messages in order and answers each
+ * with one response message. The address is taken modulo the memory size.
+ * The peer exits when the bridge closes the connection.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <iostream>
+#include <vector>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/un.h>
+#include "remote_protocol.h"
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+//! Executes one request message and builds the response message.
+//
+//! @param mem    The memory contents
+//! @param hdr    Header of the request
+//! @param body   Requests behind the header
+//! @param rsp    The response message, header included
+//
+//! @return False if the request message is malformed
+//------------------------------------------------------------------------------
+static bool execute(vector<uint8_t>& mem, const remote_header& hdr,
+                    const vector<uint8_t>& body, vector<uint8_t>& rsp)
+{
+    remote_header rh = hdr;
+    rsp.resize(sizeof(rh));
+
+    size_t pos = 0;
+    for (uint32_t i = 0; i < hdr.n_records; i++)
+    {
+        remote_request req;
+        if (pos + sizeof(req) > body.size()) return false;
+        memcpy(&req, &body[pos], sizeof(req));
+        pos += sizeof(req);
+
+        const uint8_t* data = &body[0] + pos;
+        if (req.cmd == REMOTE_WRITE) pos += req.length;
+        const uint8_t* be = &body[0] + pos;
+        pos += req.be_length;
+        if (pos > body.size()) return false;
+
+        remote_response r;
+        memset(&r, 0, sizeof(r));
+        r.cmd = req.cmd;
+
+        uint64_t offset = req.addr % mem.size();
+        uint32_t n      = 0;
+
+        if (req.cmd != REMOTE_READ && req.cmd != REMOTE_WRITE)
+        {
+            r.status = REMOTE_COMMAND_ERROR;
+        }
+        else if (offset + req.length <= mem.size())
+        {
+            r.status = REMOTE_OK;
+            n = req.length;
+        }
+        else if (req.flags & REMOTE_FLAG_DEBUG)
+        {
+            r.status = REMOTE_OK;   // debug accesses are clipped
+            n = mem.size() - offset;
+        }
+        else
+        {
+            r.status = REMOTE_ADDRESS_ERROR;
+        }
+
+        if (r.status == REMOTE_OK && req.cmd == REMOTE_WRITE)
+        {
+            for (uint32_t k = 0; k < n; k++)
+            {
+                if (req.be_length == 0 || be[k % req.be_length]) mem[offset + k] = data[k];
+            }
+        }
+        r.length = n;
+
+        const uint8_t* p = reinterpret_cast<const uint8_t*>(&r);
+        rsp.insert(rsp.end(), p, p + sizeof(r));
+
+        if (req.cmd == REMOTE_READ && n)
+        {
+            rsp.insert(rsp.end(), &mem[offset], &mem[offset] + n);
+        }
+    }
+
+    rh.n_bytes = rsp.size() - sizeof(rh);
+    memcpy(&rsp[0], &rh, sizeof(rh));
+    return true;
+}
+
+
+// -----------------------------------------------------------------------------
+//! main program of the peer
+// -----------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    const char* path = (argc > 1) ? argv[1] : "/tmp/vp_remote.sock";
+    size_t      size = (argc > 2) ? atoll(argv[2]) : 65536;
+
+    vector<uint8_t> mem(size ? size : 1, 0);
+
+    struct sockaddr_un sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sun_family = AF_UNIX;
+    strncpy(sa.sun_path, path, sizeof(sa.sun_path) - 1);
+    unlink(path);
+
+    int lfd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (lfd < 0 || bind(lfd, (struct sockaddr*) &sa, sizeof(sa)) != 0 ||
+        listen(lfd, 1) != 0)
+    {
+        cerr << "Error: can not listen on " << path << endl;
+        return 1;
+    }
+
+    cout << "(Peer) listening on " << path << endl;
+    int fd = accept(lfd, 0, 0);
+    close(lfd);
+    unlink(path);
+    if (fd < 0) return 1;
+
+    uint64_t n_messages = 0, n_records = 0;
+    vector<uint8_t> body, rsp;
+
+    remote_header hdr;
+    while (remote_recv(fd, &hdr, sizeof(hdr)))
+    {
+        if (hdr.magic != REMOTE_MAGIC)
+        {
+            cerr << "Error: invalid message" << endl;
+            break;
+        }
+
+        body.resize(hdr.n_bytes);
+        if (hdr.n_bytes && !remote_recv(fd, &body[0], hdr.n_bytes)) break;
+
+        if (!execute(mem, hdr, body, rsp))
+        {
+            cerr << "Error: malformed message " << hdr.seq << endl;
+            break;
+        }
+        if (!remote_send(fd, &rsp[0], rsp.size())) break;
+
+        n_messages++;
+        n_records += hdr.n_records;
+    }
+
+    close(fd);
+    cout << "(Peer) " << n_records << " transactions in " << n_messages
+         << " messages" << endl;
+    return 0;
+}
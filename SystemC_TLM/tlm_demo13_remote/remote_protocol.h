@@ -0,0 +1,122 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo13_remote/remote_protocol.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Message format between the remote bridge and its peer
+ *
+ * Both ends run on the same machine, all fields are in host byte order.
+ *
+ *   request message   remote_header, n_records times:
+ *                       remote_request, write data (writes), byte enables
+ *   response message  remote_header, n_records times:
+ *                       remote_response, read data (reads)
+ *
+ * A response for a read is followed by remote_response::length data bytes.
+ *
+ * The peer answers every request message with exactly one response message,
+ * in order. The header does not depend on SystemC.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo13_remote_protocol_h_
+#define _tlm_demo13_remote_protocol_h_
+
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+//! Magic number of every message, "VPRB".
+#define REMOTE_MAGIC  0x42525056u
+
+
+//! Commands of a request.
+enum remote_command { REMOTE_READ = 0, REMOTE_WRITE = 1 };
+
+//! Flags of a request.
+enum remote_flags { REMOTE_FLAG_DEBUG = 1 };
+
+//! Status of a response.
+enum remote_status
+{
+    REMOTE_OK            = 0,
+    REMOTE_ADDRESS_ERROR = 1,
+    REMOTE_GENERIC_ERROR = 2,
+    REMOTE_COMMAND_ERROR = 3
+};
+
+
+//------------------------------------------------------------------------------
+//! Header of a message.
+//------------------------------------------------------------------------------
+struct remote_header
+{
+    uint32_t  magic;      //!< REMOTE_MAGIC
+    uint32_t  seq;        //!< Sequence number, the response repeats it
+    uint32_t  n_records;  //!< Number of requests or responses
+    uint32_t  n_bytes;    //!< Size of the message behind the header
+};
+
+//------------------------------------------------------------------------------
+//! One transaction of a request message.
+//------------------------------------------------------------------------------
+struct remote_request
+{
+    uint8_t   cmd;        //!< remote_command
+    uint8_t   flags;      //!< remote_flags
+    uint16_t  be_length;  //!< Byte enable length, zero if unused
+    uint32_t  length;     //!< Data length
+    uint64_t  addr;       //!< Address
+};
+
+//------------------------------------------------------------------------------
+//! One transaction of a response message.
+//------------------------------------------------------------------------------
+struct remote_response
+{
+    uint8_t   status;     //!< remote_status
+    uint8_t   cmd;        //!< remote_command of the request
+    uint8_t   pad[2];
+    uint32_t  length;     //!< Bytes transferred, read data of this length follows
+};
+
+
+//------------------------------------------------------------------------------
+//! Sends n bytes, returns false if the connection is broken.
+//------------------------------------------------------------------------------
+inline bool remote_send(int fd, const void* buf, size_t n)
+{
+    const char* p = static_cast<const char*>(buf);
+    while (n > 0)
+    {
+        ssize_t r = send(fd, p, n, MSG_NOSIGNAL);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        p += r;
+        n -= r;
+    }
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//! Receives n bytes, returns false if the connection is broken.
+//------------------------------------------------------------------------------
+inline bool remote_recv(int fd, void* buf, size_t n)
+{
+    char* p = static_cast<char*>(buf);
+    while (n > 0)
+    {
+        ssize_t r = recv(fd, p, n, 0);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return false;
+        p += r;
+        n -= r;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,81 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo13_remote/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo13 (remote co-simulation)
+ *
+ * Usage: tlm_demo13_remote [socket path] [transactions] [batch size]
+ *
+ * Two traffic generators access a memory in another process through the bus
+ * and the remote bridge. Start tlm_demo13_peer with the same socket path
+ * first, or in parallel.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo3_sync/bus.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+#include "remote_bridge.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo13
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    string       path    = (argc > 1) ? argv[1] : "/tmp/vp_remote.sock";
+    unsigned int n_batch = (argc > 3) ? atoi(argv[3]) : 256;
+    
+    traffic_config config;
+    config.pattern        = PATTERN_SEQUENTIAL;
+    config.base_addr      = 0x00000000;
+    config.range          = 65536;
+    config.read_ratio     = 0.1;
+    config.access_size    = 4;
+    config.issue_interval = sc_core::sc_time(1, sc_core::SC_NS);
+    config.n_transactions = (argc > 2) ? atoll(argv[2]) : 1000000;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    //! Instantiate the modules
+    traffic_generator *i_gen0   = new traffic_generator("i_gen0", config);
+    config.seed = 2;
+    traffic_generator *i_gen1   = new traffic_generator("i_gen1", config);
+    bus               *i_bus    = new bus("i_bus");
+    remote_bridge     *i_bridge = new remote_bridge("i_bridge", path, n_batch);
+    
+    //! Bind  the TLM ports
+    i_gen0->data_bus.bind( i_bus->data_bus0 );
+    i_gen1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_bridge->data_bus);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 13 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << i_bridge->get_transactions() <<"             #"<<endl;
+    cout << "# Messages         : " << setw(10) << setfill(' ') << i_bridge->get_messages()     <<"             #"<<endl;
+    cout << "# Round trips      : " << setw(10) << setfill(' ') << i_bridge->get_round_trips()  <<"             #"<<endl;
+    cout << "# Errors           : " << setw(10) << setfill(' ') << i_bridge->get_errors()       <<"             #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
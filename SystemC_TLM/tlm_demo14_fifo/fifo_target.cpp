@@ -0,0 +1,183 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/fifo_target.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Memory mapped FIFO/mailbox module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "fifo_target.h"
+
+#include <string.h>
+
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the FIFO module
+//
+//! @param name   SystemC module name
+//! @param depth  Maximal number of words in the FIFO
+//------------------------------------------------------------------------------
+fifo_target::fifo_target(sc_module_name name, unsigned int depth) :
+sc_module (name), data_bus("data_bus"), latency(5, SC_NS), ring(depth),
+n_words(0), n_read_stalls(0), n_write_stalls(0)
+{
+    data_bus.register_b_transport(this, &fifo_target::bus_readwrite);
+    data_bus.register_transport_dbg(this, &fifo_target::debug_transport);
+}
+
+
+//------------------------------------------------------------------------------
+//! Value of a register without side effects, DATA shows the oldest word.
+//------------------------------------------------------------------------------
+uint32_t fifo_target::peek(unsigned int offset) const
+{
+    switch (offset)
+    {
+        case REG_STATUS:
+            return (ring.size() << 16) |
+                   (ring.empty() ? 0 : STATUS_NOT_EMPTY) |
+                   (ring.full()  ? STATUS_FULL : 0);
+        case REG_DEPTH:
+            return ring.get_depth();
+        default:
+            return 0;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Waits for an event of the FIFO, the caller retries its access afterwards.
+//
+//! A decoupled thread is first synchronized to its local time offset only,
+//! since the other side may have changed the FIFO meanwhile. Once in sync, it
+//! waits for the event.
+//
+//! @param e      The event to wait for
+//! @param delay  Local time offset of the initiator, zero afterwards
+//
+//! @return False if called from a method process, which can not wait
+//------------------------------------------------------------------------------
+bool fifo_target::block(sc_event& e, sc_time& delay)
+{
+    sc_curr_proc_kind kind = sc_get_current_process_handle().proc_kind();
+    if (kind != SC_THREAD_PROC_ && kind != SC_CTHREAD_PROC_) return false;
+
+    if (delay != SC_ZERO_TIME)
+    {
+        wait(delay);
+        delay = SC_ZERO_TIME;
+    }
+    else
+    {
+        wait(e);
+    }
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//! Blocking transport callback function, pushes or pops a word or reads a
+//! status register.
+//
+//! @param payload  The generic TLM payload, 4-byte accesses, no byte enables
+//! @param delay    How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void fifo_target::bus_readwrite( tlm::tlm_generic_payload& payload,
+                                 sc_time& delay )
+{
+    tlm::tlm_command cmd      = payload.get_command();
+    unsigned int     offset   = payload.get_address() & 0xF;
+    unsigned char*   data_ptr = payload.get_data_ptr();
+    uint32_t         word     = 0;
+
+    if (cmd == tlm::TLM_IGNORE_COMMAND)
+    {
+        payload.set_response_status( tlm::TLM_OK_RESPONSE );
+        return;
+    }
+
+    if (payload.get_data_length() != 4 || payload.get_streaming_width() < 4)
+    {
+        payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+        return;
+    }
+
+    if (offset != REG_DATA)
+    {
+        if (cmd == tlm::TLM_WRITE_COMMAND)
+        {
+            payload.set_response_status( tlm::TLM_COMMAND_ERROR_RESPONSE );
+            return;
+        }
+        word = peek(offset);
+        memcpy(data_ptr, &word, 4);
+    }
+    else if (cmd == tlm::TLM_WRITE_COMMAND)
+    {
+        memcpy(&word, data_ptr, 4);
+
+        bool was_empty = ring.empty();
+        if (!ring.push(word))
+        {
+            n_write_stalls++;
+            do
+            {
+                if (!block(space_freed, delay))
+                {
+                    payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+                    return;
+                }
+            } while (!ring.push(word));
+            was_empty = (ring.size() == 1);
+        }
+        if (was_empty) data_written.notify(delay);
+        n_words++;
+    }
+    else
+    {
+        bool was_full = ring.full();
+        if (!ring.pop(word))
+        {
+            n_read_stalls++;
+            do
+            {
+                if (!block(data_written, delay))
+                {
+                    payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
+                    return;
+                }
+            } while (!ring.pop(word));
+            was_full = (ring.size() + 1 == ring.get_depth());
+        }
+        if (was_full) space_freed.notify(delay);
+        memcpy(data_ptr, &word, 4);
+    }
+
+    delay += latency;
+    payload.set_response_status( tlm::TLM_OK_RESPONSE );
+}
+
+
+//------------------------------------------------------------------------------
+//! Debug transport callback function, reads the registers without removing
+//! a word.
+//
+//! @param payload  The generic TLM payload
+//
+//! @return  The number of bytes transferred
+//------------------------------------------------------------------------------
+unsigned int fifo_target::debug_transport( tlm::tlm_generic_payload& payload )
+{
+    if (payload.get_command() != tlm::TLM_READ_COMMAND) return 0;
+
+    unsigned int n    = payload.get_data_length() < 4 ? payload.get_data_length() : 4;
+    uint32_t     word = peek(payload.get_address() & 0xF);
+    memcpy(payload.get_data_ptr(), &word, n);
+    return n;
+}
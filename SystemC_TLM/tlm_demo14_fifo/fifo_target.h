@@ -0,0 +1,92 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/fifo_target.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Memory mapped FIFO/mailbox module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo14_fifo_target_h_
+#define _tlm_demo14_fifo_target_h_
+
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "spsc_ring.h"
+
+
+//------------------------------------------------------------------------------
+//! Memory mapped FIFO of 32-bit words between one producer and one consumer.
+//
+//! Register map, the address is taken modulo 16:
+//! - 0x0 DATA    write appends a word, read removes the oldest word
+//! - 0x4 STATUS  bit 0 not empty, bit 1 full, bits 16-31 number of words
+//! - 0x8 DEPTH   maximal number of words
+//
+//! A read of DATA from an empty FIFO and a write to a full FIFO block in
+//! b_transport: the initiator is synchronized to its local time and then waits
+//! for ::data_written or ::space_freed, so neither side polls. From a method
+//! process, which can not wait, such an access fails with a generic error and
+//! the model waits for the events itself. The events are notified at the
+//! local time of the access which made the FIFO non-empty or non-full.
+//------------------------------------------------------------------------------
+class fifo_target : public sc_core::sc_module
+{
+public:
+
+    //! Register offsets.
+    enum { REG_DATA = 0x0, REG_STATUS = 0x4, REG_DEPTH = 0x8 };
+
+    //! Bits of the STATUS register.
+    enum { STATUS_NOT_EMPTY = 0x1, STATUS_FULL = 0x2 };
+
+    //! Class Construct
+    fifo_target(sc_core::sc_module_name name, unsigned int depth = 16);
+
+    //! TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_target_socket<fifo_target> data_bus;
+
+    //! Delay annotated per access.
+    sc_core::sc_time latency;
+
+    //! Notified when a word was written to the empty FIFO.
+    sc_core::sc_event data_written;
+
+    //! Notified when a word was read from the full FIFO.
+    sc_core::sc_event space_freed;
+
+    //! Number of words passed through the FIFO.
+    sc_dt::uint64 get_words() const { return n_words; }
+
+    //! Number of reads which had to wait for data.
+    sc_dt::uint64 get_read_stalls() const { return n_read_stalls; }
+
+    //! Number of writes which had to wait for space.
+    sc_dt::uint64 get_write_stalls() const { return n_write_stalls; }
+
+private:
+
+    //! Blocking transport routine the target socket.
+    void bus_readwrite(tlm::tlm_generic_payload& payload, sc_core::sc_time& delay);
+
+    //! Debug transport routine the target socket, reads the registers.
+    unsigned int debug_transport(tlm::tlm_generic_payload& payload);
+
+    //! Value of a register without side effects.
+    uint32_t peek(unsigned int offset) const;
+
+    //! Synchronizes the calling thread and waits for e, false from a method.
+    bool block(sc_core::sc_event& e, sc_core::sc_time& delay);
+
+    //! The words in the FIFO.
+    spsc_ring<uint32_t> ring;
+
+    //! Statistics.
+    sc_dt::uint64 n_words, n_read_stalls, n_write_stalls;
+};
+
+#endif
@@ -0,0 +1,55 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/processor0.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (producer) module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor0.h"
+#include "fifo_target.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor0 module
+//
+//! @param name       SystemC module name
+//! @param n_words    Number of words to produce
+//! @param t_prepare  Time to prepare one word
+//------------------------------------------------------------------------------
+processor0::processor0(sc_module_name  name,
+                       uint32_t        n_words,
+                       const sc_time&  t_prepare) :
+processor (name), n_words(n_words), t_prepare(t_prepare)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread producing the words.
+//
+// Unlike tlm_demo3 all words go to the same address, the FIFO data register.
+// A write to the full FIFO returns when the consumer made space.
+// -----------------------------------------------------------------------------
+void processor0::program_main()
+{
+    for (uint32_t wdata = 0; wdata < n_words; wdata++)
+    {
+        wait(t_prepare); // data prepare program
+        
+        if(bus_readwrite(tlm::TLM_WRITE_COMMAND, fifo_target::REG_DATA, 4,
+                         reinterpret_cast<uint8_t *>(&wdata), 0)
+           ){
+            cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+        }
+    }
+}
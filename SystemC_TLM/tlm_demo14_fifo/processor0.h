@@ -0,0 +1,46 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/processor0.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (producer) module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo14_processor0_h_
+#define _tlm_demo14_processor0_h_
+
+#include "../tlm_demo2/processor.h"
+
+//------------------------------------------------------------------------------
+//! Producer core, writes consecutive words to the FIFO data register.
+//------------------------------------------------------------------------------
+class processor0 : public  processor
+{
+public:
+    
+    //! Class Construct
+    //
+    //! @param name       SystemC module name
+    //! @param n_words    Number of words to produce
+    //! @param t_prepare  Time to prepare one word
+    processor0(sc_core::sc_module_name  name,
+               uint32_t                 n_words,
+               const sc_core::sc_time&  t_prepare);
+    
+private:
+    
+    //! SystemC Thread producing the words.
+    void program_main();
+    
+    //! Number of words to produce.
+    uint32_t n_words;
+    
+    //! Time to prepare one word.
+    sc_core::sc_time t_prepare;
+};
+
+#endif
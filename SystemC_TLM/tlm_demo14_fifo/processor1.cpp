@@ -0,0 +1,64 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/processor1.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 (consumer) module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor1.h"
+#include "fifo_target.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor1 module
+//
+//! @param name       SystemC module name
+//! @param n_words    Number of words to consume
+//! @param t_process  Time to process one word
+//------------------------------------------------------------------------------
+processor1::processor1(sc_module_name  name,
+                       uint32_t        n_words,
+                       const sc_time&  t_process) :
+processor (name), n_words(n_words), t_process(t_process), n_errors(0)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread consuming the words.
+//
+// No head start is needed as in tlm_demo3: a read of the empty FIFO returns
+// when the producer wrote the next word.
+// -----------------------------------------------------------------------------
+void processor1::program_main()
+{
+    uint32_t rdata = 0;
+    
+    for (uint32_t expected = 0; expected < n_words; expected++)
+    {
+        if(bus_readwrite(tlm::TLM_READ_COMMAND, fifo_target::REG_DATA, 4,
+                         reinterpret_cast<uint8_t *>(&rdata), 0)
+           ){
+            cout << "     (cpu1) @ " << sc_time_stamp() << ", Read Failed.\n";
+            n_errors++;
+        }
+        else if (rdata != expected)
+        {
+            cout << "     (cpu1) @ " << sc_time_stamp() << ", Read 0x";
+            cout << hex << rdata << ", expected 0x" << expected << dec << endl;
+            n_errors++;
+        }
+        
+        wait(t_process); // data process program
+    }
+}
@@ -0,0 +1,53 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/processor1.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 (consumer) module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo14_processor1_h_
+#define _tlm_demo14_processor1_h_
+
+#include "../tlm_demo2/processor.h"
+
+//------------------------------------------------------------------------------
+//! Consumer core, reads the words from the FIFO data register and checks
+//! their order.
+//------------------------------------------------------------------------------
+class processor1 : public  processor
+{
+public:
+    
+    //! Class Construct
+    //
+    //! @param name       SystemC module name
+    //! @param n_words    Number of words to consume
+    //! @param t_process  Time to process one word
+    processor1(sc_core::sc_module_name  name,
+               uint32_t                 n_words,
+               const sc_core::sc_time&  t_process);
+    
+    //! Number of words received in the wrong order or failed reads.
+    uint32_t get_errors() const { return n_errors; }
+    
+private:
+    
+    //! SystemC Thread consuming the words.
+    void program_main();
+    
+    //! Number of words to consume.
+    uint32_t n_words;
+    
+    //! Time to process one word.
+    sc_core::sc_time t_process;
+    
+    //! Number of errors.
+    uint32_t n_errors;
+};
+
+#endif
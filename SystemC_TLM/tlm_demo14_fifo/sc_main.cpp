@@ -0,0 +1,71 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo14 (FIFO between producer and consumer)
+ *
+ * Usage: tlm_demo14_fifo [depth] [words] [prepare ns] [process ns]
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo3_sync/bus.h"
+#include "fifo_target.h"
+#include "processor0.h"
+#include "processor1.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo14
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    unsigned int depth     = (argc > 1) ? atoi(argv[1]) : 8;
+    uint32_t     n_words   = (argc > 2) ? atoi(argv[2]) : 1000;
+    double       t_prepare = (argc > 3) ? atof(argv[3]) : 20;
+    double       t_process = (argc > 4) ? atof(argv[4]) : 30;
+    
+    //! Instantiate the modules
+    processor0   *i_cpu0 = new processor0("i_cpu0", n_words,
+                                          sc_core::sc_time(t_prepare, sc_core::SC_NS));
+    processor1   *i_cpu1 = new processor1("i_cpu1", n_words,
+                                          sc_core::sc_time(t_process, sc_core::SC_NS));
+    fifo_target  *i_fifo = new fifo_target("i_fifo", depth);
+    bus          *i_bus  = new bus("i_bus");
+    
+    //! Bind  the TLM ports
+    i_cpu0->data_bus.bind( i_bus->data_bus0 );
+    i_cpu1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_fifo->data_bus);
+    
+    // runs until both programs are done
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds() * 1e9;
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 14 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Words            : " << setw(10) << setfill(' ') << i_fifo->get_words()        <<"             #"<<endl;
+    cout << "# Read stalls      : " << setw(10) << setfill(' ') << i_fifo->get_read_stalls()  <<"             #"<<endl;
+    cout << "# Write stalls     : " << setw(10) << setfill(' ') << i_fifo->get_write_stalls() <<"             #"<<endl;
+    cout << "# Errors           : " << setw(10) << setfill(' ') << i_cpu1->get_errors()       <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
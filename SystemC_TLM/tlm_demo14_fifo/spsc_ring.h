@@ -0,0 +1,104 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo14_fifo/spsc_ring.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Lock-free single-producer/single-consumer ring buffer
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo14_spsc_ring_h_
+#define _tlm_demo14_spsc_ring_h_
+
+#include <atomic>
+#include <vector>
+#include <stdint.h>
+
+
+//------------------------------------------------------------------------------
+//! Bounded ring buffer for one producer and one consumer thread.
+//
+//! The head is only written by the consumer, the tail only by the producer,
+//! so no lock is needed: the release store of an index publishes the slot it
+//! covers, the acquire load on the other side sees it. The indices count
+//! without wrapping around the depth, a slot is index & mask of a power of
+//! two storage, the depth itself can be any size.
+//
+//! @tparam T  Element type, copyable
+//------------------------------------------------------------------------------
+template <class T>
+class spsc_ring
+{
+public:
+
+    //! Class constructor
+    //
+    //! @param depth  Maximal number of elements, at least 1
+    explicit spsc_ring(uint32_t depth) : depth(depth ? depth : 1), head(0), tail(0)
+    {
+        uint32_t size = 1;
+        while (size < this->depth) size <<= 1;
+        slots.resize(size);
+        mask = size - 1;
+    }
+
+    //! Appends an element, false if the ring is full. Producer only.
+    bool push(const T& v)
+    {
+        uint32_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == depth) return false;
+
+        slots[t & mask] = v;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Removes the oldest element, false if the ring is empty. Consumer only.
+    bool pop(T& v)
+    {
+        uint32_t h = head.load(std::memory_order_relaxed);
+        if (tail.load(std::memory_order_acquire) == h) return false;
+
+        v = slots[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    //! Number of elements, exact only for the producer or the consumer.
+    uint32_t size() const
+    {
+        return tail.load(std::memory_order_acquire) -
+               head.load(std::memory_order_acquire);
+    }
+
+    //! True if no element is stored.
+    bool empty() const { return size() == 0; }
+
+    //! True if ::depth elements are stored.
+    bool full() const { return size() == depth; }
+
+    //! Maximal number of elements.
+    uint32_t get_depth() const { return depth; }
+
+private:
+
+    //! Maximal number of elements.
+    const uint32_t depth;
+
+    //! Storage size minus one.
+    uint32_t mask;
+
+    //! Element storage.
+    std::vector<T> slots;
+
+    //! Index of the oldest element, written by the consumer.
+    std::atomic<uint32_t> head;
+
+    //! Index behind the newest element, written by the producer.
+    std::atomic<uint32_t> tail;
+};
+
+#endif
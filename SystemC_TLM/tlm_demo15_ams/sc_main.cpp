@@ -0,0 +1,66 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo15_ams/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo15 (SystemC-AMS sensor front-end)
+ *
+ * Usage: tlm_demo15_ams [sample period ns] [batch] [simulated time us]
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "sensor_adc.h"
+#include "tdf_tlm_bridge.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo15
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    double       t_sample = (argc > 1) ? atof(argv[1]) : 10;
+    unsigned int batch    = (argc > 2) ? atoi(argv[2]) : 16;
+    double       t_sim    = (argc > 3) ? atof(argv[3]) : 1000;
+    
+    //! Instantiate the modules, the ring buffer is the upper half of the memory
+    sensor_adc     *i_adc    = new sensor_adc("i_adc",
+                                   sca_core::sca_time(t_sample, sc_core::SC_NS));
+    tdf_tlm_bridge *i_bridge = new tdf_tlm_bridge("i_bridge", batch, 0x80, 32);
+    memory         *i_mem    = new memory("i_memory", false);
+    
+    sca_tdf::sca_signal<int32_t> adc_code("adc_code");
+    
+    //! Bind the TDF and TLM ports
+    i_adc->out(adc_code);
+    i_bridge->in(adc_code);
+    i_bridge->data_bus.bind(i_mem->data_bus);
+    
+    int t_start=clock();
+    sc_core::sc_start(t_sim, sc_core::SC_US);
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 15 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Samples          : " << setw(10) << setfill(' ') << i_bridge->get_samples()      <<"             #"<<endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << i_bridge->get_transactions() <<"             #"<<endl;
+    cout << "# Errors           : " << setw(10) << setfill(' ') << i_bridge->get_errors()       <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" us          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
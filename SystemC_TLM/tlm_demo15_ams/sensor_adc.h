@@ -0,0 +1,88 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo15_ams/sensor_adc.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   TDF sensor and ADC module definition and implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo15_sensor_adc_h_
+#define _tlm_demo15_sensor_adc_h_
+
+#include <math.h>
+#include <systemc-ams>
+
+
+// ----------------------------------------------------------------------------
+//! Sensor front-end with an ADC, as a TDF module.
+//
+//! The sensor signal is a sine with a small pseudo-random noise, sampled
+//! every timestep and quantized to a signed code of the ADC resolution. The
+//! codes beyond the full scale are clipped.
+// ----------------------------------------------------------------------------
+class sensor_adc : public sca_tdf::sca_module
+{
+public:
+    //! @brief The ADC codes, one per timestep.
+    sca_tdf::sca_out<int32_t>  out;
+    
+    // -------------------------------------------------------------------------
+    //! Custom Constructor for the sensor.
+    //
+    //! @param name       The SystemC module name
+    //! @param t_sample   The sampling period
+    //! @param frequency  Frequency of the sensor signal in Hz
+    //! @param bits       Resolution of the ADC, at most 31
+    // -------------------------------------------------------------------------
+    sensor_adc(sc_core::sc_module_name   name,
+               const sca_core::sca_time& t_sample,
+               double                    frequency = 1e4,
+               unsigned int              bits      = 12)
+    : sca_tdf::sca_module(name), out("out"), t_sample(t_sample),
+      frequency(frequency), full_scale((1 << (bits - 1)) - 1), rng(1)
+    {
+    }
+    
+private:
+    
+    //! TDF attributes, the sampling period.
+    void set_attributes()
+    {
+        out.set_timestep(t_sample);
+    }
+    
+    //! Samples and quantizes the sensor signal.
+    void processing()
+    {
+        rng = rng * 1103515245u + 12345u;
+        double noise = ((rng >> 16) & 0x7FFF) / 32768.0 - 0.5;
+        
+        double v = 0.9 * sin(2.0 * M_PI * frequency * get_time().to_seconds())
+                 + 0.01 * noise;
+        
+        double code = floor(v * full_scale + 0.5);
+        if (code >  full_scale)     code =  full_scale;
+        if (code < -full_scale - 1) code = -full_scale - 1;
+        
+        out.write(static_cast<int32_t>(code));
+    }
+    
+    //! The sampling period.
+    sca_core::sca_time t_sample;
+    
+    //! Frequency of the sensor signal in Hz.
+    double frequency;
+    
+    //! Largest positive code.
+    double full_scale;
+    
+    //! State of the noise generator.
+    uint32_t rng;
+};
+
+
+#endif
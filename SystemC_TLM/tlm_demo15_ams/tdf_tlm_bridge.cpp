@@ -0,0 +1,90 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo15_ams/tdf_tlm_bridge.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   TDF to TLM bridge module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "tdf_tlm_bridge.h"
+
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the bridge
+//
+//! @param name       SystemC module name
+//! @param batch      Number of samples per transaction
+//! @param base_addr  Start address of the ring buffer
+//! @param n_words    Size of the ring buffer in 32-bit words
+//------------------------------------------------------------------------------
+tdf_tlm_bridge::tdf_tlm_bridge(sc_module_name  name,
+                               unsigned int    batch,
+                               uint64_t        base_addr,
+                               unsigned int    n_words) :
+sca_tdf::sca_module (name), in("in"), data_bus("data_bus"),
+samples(batch ? batch : 1), base_addr(base_addr),
+n_words(n_words ? n_words : 1), next(0),
+n_samples(0), n_transactions(0), n_errors(0)
+{
+    sg.command = tlm::TLM_WRITE_COMMAND;
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        sg.add(0, 4, reinterpret_cast<unsigned char*>(&samples[i]));
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Sets the input rate to the batch size.
+//------------------------------------------------------------------------------
+void tdf_tlm_bridge::set_attributes()
+{
+    in.set_rate(samples.size());
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the batch of this activation in one transaction.
+//------------------------------------------------------------------------------
+void tdf_tlm_bridge::processing()
+{
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        samples[i] = in.read(i);
+        sg.segments[i].addr = base_addr + 4 * next;
+        if (++next == n_words) next = 0;
+    }
+    sg.executed = false;
+
+    trans.set_command(tlm::TLM_IGNORE_COMMAND);
+    trans.set_address(sg.segments[0].addr);
+    trans.set_data_ptr(0);
+    trans.set_data_length(0);
+    trans.set_streaming_width(0);
+    trans.set_byte_enable_ptr(0);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    trans.set_extension(&sg);
+
+    // the batch is complete at the time of its last sample, the TDF time is
+    // ahead of the discrete event time
+    sc_time t_last = in.get_time(samples.size() - 1);
+    sc_time delay  = (t_last > sc_time_stamp()) ?
+                     t_last - sc_time_stamp() : SC_ZERO_TIME;
+
+    sg_transport(data_bus, trans, delay);
+    trans.clear_extension(&sg);
+
+    n_transactions++;
+    n_samples += samples.size();
+    for (size_t i = 0; i < samples.size(); i++)
+    {
+        if (sg.segments[i].status != tlm::TLM_OK_RESPONSE) n_errors++;
+    }
+}
@@ -0,0 +1,91 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo15_ams/tdf_tlm_bridge.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   TDF to TLM bridge module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo15_tdf_tlm_bridge_h_
+#define _tlm_demo15_tdf_tlm_bridge_h_
+
+#include <vector>
+#include <systemc-ams>
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "../tlm_demo2/sg_extension.h"
+
+
+//------------------------------------------------------------------------------
+//! Bridge writing TDF samples into a ring buffer in memory.
+//
+//! The rate of the input port is the batch size, so the TDF scheduler hands
+//! over a whole batch per activation. The batch is written in one
+//! scatter-gather transaction, one 32-bit word per sample, to the next words
+//! of the ring buffer. The memory of tlm_demo2 accepts at most 4 bytes per
+//! access, a scatter-gather transaction is its burst.
+//
+//! The TDF cluster may run ahead of the discrete event time. The batch is
+//! written at the time of its last sample, its difference to the discrete
+//! event time is annotated as the delay of the transaction, as the local
+//! time offset of a decoupled initiator. The bridge can not wait, the target
+//! must complete the transaction without waiting.
+//------------------------------------------------------------------------------
+class tdf_tlm_bridge : public sca_tdf::sca_module
+{
+public:
+
+    //! The ADC codes.
+    sca_tdf::sca_in<int32_t>  in;
+
+    //! TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<tdf_tlm_bridge>  data_bus;
+
+    //! Class Construct
+    tdf_tlm_bridge(sc_core::sc_module_name  name,
+                   unsigned int             batch,
+                   uint64_t                 base_addr,
+                   unsigned int             n_words);
+
+    //! Number of samples written.
+    sc_dt::uint64 get_samples() const { return n_samples; }
+
+    //! Number of transactions issued.
+    sc_dt::uint64 get_transactions() const { return n_transactions; }
+
+    //! Number of samples with an error response.
+    sc_dt::uint64 get_errors() const { return n_errors; }
+
+private:
+
+    //! TDF attributes, the batch size as input rate.
+    void set_attributes();
+
+    //! Writes one batch of samples.
+    void processing();
+
+    //! Samples of the current batch.
+    std::vector<int32_t> samples;
+
+    //! Segments of the current batch, pointing to ::samples.
+    sg_extension sg;
+
+    //! The carrier payload of the batches.
+    tlm::tlm_generic_payload trans;
+
+    //! Start address and size in words of the ring buffer.
+    uint64_t base_addr;
+    unsigned int n_words;
+
+    //! Ring buffer index of the next sample.
+    unsigned int next;
+
+    //! Statistics.
+    sc_dt::uint64 n_samples, n_transactions, n_errors;
+};
+
+#endif
@@ -0,0 +1,296 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo16_dma/dma.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   DMA controller module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "dma.h"
+
+#include <string.h>
+
+SC_HAS_PROCESS( dma );
+
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! True if the DMI region is valid and covers addr.
+//------------------------------------------------------------------------------
+static inline bool covers(const tlm::tlm_dmi& region, bool valid, uint64_t addr)
+{
+    return valid && addr >= region.get_start_address() &&
+           addr <= region.get_end_address();
+}
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the DMA controller
+//
+//! @param name  SystemC module name
+//------------------------------------------------------------------------------
+dma::dma(sc_module_name name) :
+reg_bank (name, 0x20), data_bus("data_bus"), irq("irq"),
+dmi_src_valid(false), dmi_dst_valid(false),
+n_bytes(0), n_dmi_bytes(0), n_transactions(0), n_descriptors(0)
+{
+    data_bus.register_invalidate_direct_mem_ptr(this, &dma::invalidate_direct_mem_ptr);
+
+    latency = sc_time(5, SC_NS);
+
+    // the transfer registers are stored only while the engine is idle, the
+    // bytes not written are kept
+    const uint32_t params[] = { REG_SRC, REG_DST, REG_LEN, REG_DESC, REG_BURST };
+    for (unsigned int i = 0; i < sizeof(params) / sizeof(params[0]); i++)
+    {
+        uint32_t offset = params[i];
+        add_register(offset, 4, (offset == REG_BURST) ? 64 : 0, 0, read_callback(),
+                     [this, offset](uint32_t data, sc_time&) {
+                         if (!(reg(REG_STATUS) & STATUS_BUSY))
+                             reg(offset) = merge_write(reg(offset), data);
+                     });
+    }
+    add_register(REG_CTRL, 4, 0, CTRL_CHAIN | CTRL_IRQ_EN, read_callback(),
+                 [this](uint32_t data, sc_time& delay) { write_ctrl(data, delay); });
+    add_register(REG_STATUS, 4, 0, 0, read_callback(),
+                 [this](uint32_t data, sc_time& delay) { write_status(data, delay); });
+
+    SC_THREAD(engine);
+
+    SC_METHOD(irq_method);
+    sensitive << irq_update;
+    dont_initialize();
+}
+
+
+//------------------------------------------------------------------------------
+//! The SystemC thread executing a transfer or a descriptor chain per start.
+//------------------------------------------------------------------------------
+void dma::engine()
+{
+    while (true)
+    {
+        wait(start);
+        q_keeper.reset();
+
+        uint32_t burst = reg(REG_BURST) & ~3u;
+        buffer.resize(burst ? burst : 4);
+
+        bool ok = true;
+        if (reg(REG_CTRL) & CTRL_CHAIN)
+        {
+            uint32_t desc = reg(REG_DESC);
+            for (unsigned int n = 0; desc != 0 && ok; n++)
+            {
+                if (n == MAX_DESCRIPTORS) { ok = false; break; }
+
+                // source, destination, length, next
+                uint32_t d[4];
+                ok = transfer(tlm::TLM_READ_COMMAND, desc,
+                              reinterpret_cast<uint8_t*>(d), sizeof(d)) &&
+                     copy(d[0], d[1], d[2]);
+                desc = d[3];
+                n_descriptors++;
+            }
+        }
+        else
+        {
+            ok = copy(reg(REG_SRC), reg(REG_DST), reg(REG_LEN));
+        }
+
+        // completes at the local time of the engine
+        q_keeper.sync();
+
+        uint32_t& status = reg(REG_STATUS);
+        status = (status & ~STATUS_BUSY) | STATUS_DONE | (ok ? 0 : STATUS_ERROR);
+        irq_update.notify(SC_ZERO_TIME);
+        done.notify();
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Sets ::irq while DONE is set and the interrupt is enabled. The engine and
+//! the register callbacks run in different processes, they only notify
+//! ::irq_update, so the signal has a single writer.
+//------------------------------------------------------------------------------
+void dma::irq_method()
+{
+    irq.write((reg(REG_STATUS) & STATUS_DONE) && (reg(REG_CTRL) & CTRL_IRQ_EN));
+}
+
+
+//------------------------------------------------------------------------------
+//! Copies len bytes from src to dst, through DMI if granted, in bursts
+//! otherwise.
+//
+//! @return False if a transaction failed
+//------------------------------------------------------------------------------
+bool dma::copy(uint64_t src, uint64_t dst, uint32_t len)
+{
+    while (len > 0)
+    {
+        uint32_t n = copy_dmi(src, dst, len);
+        if (n == 0)
+        {
+            n = (len < buffer.size()) ? len : buffer.size();
+
+            if (!transfer(tlm::TLM_READ_COMMAND, src, &buffer[0], n)) return false;
+            if (trans.is_dmi_allowed() && !covers(dmi_src, dmi_src_valid, src))
+            {
+                request_dmi(src, dmi_src, dmi_src_valid);
+            }
+
+            if (!transfer(tlm::TLM_WRITE_COMMAND, dst, &buffer[0], n)) return false;
+            if (trans.is_dmi_allowed() && !covers(dmi_dst, dmi_dst_valid, dst))
+            {
+                request_dmi(dst, dmi_dst, dmi_dst_valid);
+            }
+        }
+
+        src += n;
+        dst += n;
+        len -= n;
+        n_bytes += n;
+
+        if (q_keeper.need_sync()) q_keeper.sync();
+    }
+    return true;
+}
+
+
+//------------------------------------------------------------------------------
+//! Copies through the cached DMI regions.
+//
+//! @return The bytes copied, up to the end of either region, 0 if the regions
+//!         do not cover src and dst
+//------------------------------------------------------------------------------
+uint32_t dma::copy_dmi(uint64_t src, uint64_t dst, uint32_t len)
+{
+    if (!covers(dmi_src, dmi_src_valid, src) || !dmi_src.is_read_allowed() ||
+        !covers(dmi_dst, dmi_dst_valid, dst) || !dmi_dst.is_write_allowed())
+    {
+        return 0;
+    }
+
+    uint64_t n = len;
+    if (n > dmi_src.get_end_address() - src + 1) n = dmi_src.get_end_address() - src + 1;
+    if (n > dmi_dst.get_end_address() - dst + 1) n = dmi_dst.get_end_address() - dst + 1;
+
+    memmove(dmi_dst.get_dmi_ptr() + (dst - dmi_dst.get_start_address()),
+            dmi_src.get_dmi_ptr() + (src - dmi_src.get_start_address()), n);
+
+    // the latency of the words moved
+    double words = double((n + 3) / 4);
+    q_keeper.inc(dmi_src.get_read_latency() * words + dmi_dst.get_write_latency() * words);
+
+    n_dmi_bytes += n;
+    return n;
+}
+
+
+//------------------------------------------------------------------------------
+//! Reads or writes len bytes in one scatter-gather transaction of words.
+//
+//! @return False on an error response
+//------------------------------------------------------------------------------
+bool dma::transfer(tlm::tlm_command cmd, uint64_t addr, uint8_t* data, uint32_t len)
+{
+    sg.command = cmd;
+    sg.clear();
+    for (uint32_t off = 0; off < len; off += 4)
+    {
+        sg.add(addr + off, (len - off < 4) ? len - off : 4, data + off);
+    }
+    sg.executed = false;
+
+    trans.set_command(tlm::TLM_IGNORE_COMMAND);
+    trans.set_address(addr);
+    trans.set_data_ptr(0);
+    trans.set_data_length(0);
+    trans.set_streaming_width(0);
+    trans.set_byte_enable_ptr(0);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    trans.set_extension(&sg);
+
+    sc_time delay = q_keeper.get_local_time();
+    sg_transport(data_bus, trans, delay);
+    trans.clear_extension(&sg);
+
+    q_keeper.set(delay);
+    n_transactions++;
+    return trans.is_response_ok();
+}
+
+
+//------------------------------------------------------------------------------
+//! Requests a DMI region covering addr, the region is invalid if refused.
+//------------------------------------------------------------------------------
+void dma::request_dmi(uint64_t addr, tlm::tlm_dmi& region, bool& valid)
+{
+    tlm::tlm_generic_payload dmi_trans;
+    dmi_trans.set_command(tlm::TLM_READ_COMMAND);
+    dmi_trans.set_address(addr);
+
+    region.init();
+    valid = data_bus->get_direct_mem_ptr(dmi_trans, region);
+}
+
+
+//------------------------------------------------------------------------------
+//! DMI invalidation callback, drops the cached regions overlapping the range.
+//------------------------------------------------------------------------------
+void dma::invalidate_direct_mem_ptr(sc_dt::uint64 start, sc_dt::uint64 end)
+{
+    if (dmi_src_valid && start <= dmi_src.get_end_address() &&
+        end >= dmi_src.get_start_address())
+    {
+        dmi_src_valid = false;
+    }
+    if (dmi_dst_valid && start <= dmi_dst.get_end_address() &&
+        end >= dmi_dst.get_start_address())
+    {
+        dmi_dst_valid = false;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Write callback of CTRL, starts the engine if START is written while idle.
+//! START is not stored, the other bits are stored by the register bank.
+//
+//! @param data   The data written
+//! @param delay  How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void dma::write_ctrl( uint32_t data, sc_time& delay )
+{
+    uint32_t& status = reg(REG_STATUS);
+
+    if ((data & CTRL_START) && !(status & STATUS_BUSY))
+    {
+        status = (status & ~(STATUS_DONE | STATUS_ERROR)) | STATUS_BUSY;
+        start.notify(delay);
+    }
+
+    // DONE or the interrupt enable may have changed
+    irq_update.notify(SC_ZERO_TIME);
+}
+
+
+//------------------------------------------------------------------------------
+//! Write callback of STATUS, a 1 clears DONE or ERROR, clearing DONE lowers
+//! the interrupt.
+//------------------------------------------------------------------------------
+void dma::write_status( uint32_t data, sc_time& delay )
+{
+    uint32_t& status = reg(REG_STATUS);
+
+    status &= ~(data & (STATUS_DONE | STATUS_ERROR));
+    irq_update.notify(SC_ZERO_TIME);
+}
@@ -0,0 +1,144 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo16_dma/dma.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   DMA controller module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo16_dma_h_
+#define _tlm_demo16_dma_h_
+
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "../tlm_demo2/reg_bank.h"
+#include "../tlm_demo2/sg_extension.h"
+
+
+//------------------------------------------------------------------------------
+//! DMA controller for memory to memory copies.
+//
+//! Register map, 32-bit registers of a reg_bank, the address is taken modulo 32:
+//! - 0x00 SRC     source address of a single transfer
+//! - 0x04 DST     destination address of a single transfer
+//! - 0x08 LEN     length in bytes of a single transfer
+//! - 0x0C CTRL    bit 0 start, bit 1 descriptor chain, bit 2 interrupt enable
+//! - 0x10 STATUS  bit 0 busy, bit 1 done, bit 2 error, write 1 to clear 1, 2
+//! - 0x14 DESC    address of the first descriptor of a chain
+//! - 0x18 BURST   burst size in bytes, default 64
+//
+//! A descriptor is four words in memory: source, destination, length and the
+//! address of the next descriptor, 0 at the end of the chain.
+//
+//! The data is copied in bursts of BURST bytes, each a scatter-gather read
+//! followed by a scatter-gather write through ::data_bus. When a target allows
+//! DMI, the following chunks are copied with memmove() through the DMI
+//! pointers, as large as the granted regions allow, and only their latency is
+//! accounted. The engine is temporally decoupled with the global quantum.
+//
+//! At the end, DONE is set in STATUS, ::done is notified and ::irq is raised if
+//! enabled. Clearing DONE in STATUS lowers ::irq. SRC, DST, LEN, DESC and
+//! BURST ignore writes while the controller is busy.
+//------------------------------------------------------------------------------
+class dma : public reg_bank
+{
+public:
+
+    //! Register offsets.
+    enum { REG_SRC = 0x00, REG_DST = 0x04, REG_LEN = 0x08, REG_CTRL = 0x0C,
+           REG_STATUS = 0x10, REG_DESC = 0x14, REG_BURST = 0x18 };
+
+    //! Bits of the CTRL register.
+    enum { CTRL_START = 0x1, CTRL_CHAIN = 0x2, CTRL_IRQ_EN = 0x4 };
+
+    //! Bits of the STATUS register.
+    enum { STATUS_BUSY = 0x1, STATUS_DONE = 0x2, STATUS_ERROR = 0x4 };
+
+    //! Class Construct
+    dma(sc_core::sc_module_name name);
+
+    //! TLM-2 socket of the data transfers.
+    tlm_utils::simple_initiator_socket<dma> data_bus;
+
+    //! Interrupt line, high while DONE is set and the interrupt is enabled.
+    sc_core::sc_signal<bool> irq;
+
+    //! Notified at the completion of every transfer or chain.
+    sc_core::sc_event done;
+
+    //! Number of bytes copied.
+    sc_dt::uint64 get_bytes() const { return n_bytes; }
+
+    //! Number of bytes copied through DMI.
+    sc_dt::uint64 get_dmi_bytes() const { return n_dmi_bytes; }
+
+    //! Number of transactions issued on ::data_bus.
+    sc_dt::uint64 get_transactions() const { return n_transactions; }
+
+    //! Number of descriptors processed.
+    sc_dt::uint64 get_descriptors() const { return n_descriptors; }
+
+private:
+
+    //! Maximal number of descriptors of a chain, against endless loops.
+    enum { MAX_DESCRIPTORS = 4096 };
+
+    //! SystemC Thread executing the transfers.
+    void engine();
+
+    //! SystemC method driving ::irq from STATUS and CTRL, its only writer.
+    void irq_method();
+
+    //! Copies len bytes from src to dst.
+    bool copy(uint64_t src, uint64_t dst, uint32_t len);
+
+    //! Copies through DMI, returns the bytes copied, 0 if not possible.
+    uint32_t copy_dmi(uint64_t src, uint64_t dst, uint32_t len);
+
+    //! Reads or writes len bytes in one scatter-gather transaction.
+    bool transfer(tlm::tlm_command cmd, uint64_t addr, uint8_t* data, uint32_t len);
+
+    //! Requests a DMI region covering addr.
+    void request_dmi(uint64_t addr, tlm::tlm_dmi& region, bool& valid);
+
+    //! Write callback of CTRL, starts the engine.
+    void write_ctrl(uint32_t data, sc_core::sc_time& delay);
+
+    //! Write callback of STATUS, clears DONE and ERROR.
+    void write_status(uint32_t data, sc_core::sc_time& delay);
+
+    //! Invalidates the cached DMI regions.
+    void invalidate_direct_mem_ptr(sc_dt::uint64 start, sc_dt::uint64 end);
+
+    //! Starts the engine.
+    sc_core::sc_event start;
+
+    //! Notified when DONE or the interrupt enable may have changed.
+    sc_core::sc_event irq_update;
+
+    //! Quantum keeper for the local time offset of the engine.
+    tlm_utils::tlm_quantumkeeper q_keeper;
+
+    //! Scatter-gather segments and carrier payload of the bursts.
+    sg_extension sg;
+    tlm::tlm_generic_payload trans;
+
+    //! Buffer of one burst.
+    std::vector<uint8_t> buffer;
+
+    //! Cached DMI regions of the source and the destination.
+    tlm::tlm_dmi dmi_src, dmi_dst;
+    bool dmi_src_valid, dmi_dst_valid;
+
+    //! Statistics.
+    sc_dt::uint64 n_bytes, n_dmi_bytes, n_transactions, n_descriptors;
+};
+
+#endif
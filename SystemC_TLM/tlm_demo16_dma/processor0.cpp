@@ -0,0 +1,97 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo16_dma/processor0.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (DMA driver) module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor0.h"
+#include "dma.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+//! Memory layout: source, descriptors and destination.
+static const uint32_t SRC_ADDR  = 0x00;
+static const uint32_t DESC_ADDR = 0x60;
+static const uint32_t DST_ADDR  = 0xA0;
+static const uint32_t N_BYTES   = 0x60;
+static const uint32_t N_DESC    = 3;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor0 module
+//
+//! @param name    SystemC module name
+//! @param n_runs  Number of times the chain is executed
+//! @param burst   Burst size of the DMA controller in bytes
+//------------------------------------------------------------------------------
+processor0::processor0(sc_module_name  name, uint32_t n_runs, uint32_t burst) :
+processor (name), irq("irq"), n_runs(n_runs), burst(burst), n_errors(0)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//! Writes a DMA register through the bus.
+// -----------------------------------------------------------------------------
+void processor0::write_reg(uint32_t offset, uint32_t value)
+{
+    if(bus_readwrite(tlm::TLM_WRITE_COMMAND, DMA_BASE + offset, 4,
+                     reinterpret_cast<uint8_t *>(&value), 0)
+       ){
+        cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+    }
+}
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread programming the DMA controller.
+//
+// The source data and a chain of three descriptors, 32 bytes each, are placed
+// in memory with debug writes and the burst size is set. Each run starts the
+// chain, sleeps until the interrupt and acknowledges it. The destination is
+// checked at the end.
+// -----------------------------------------------------------------------------
+void processor0::program_main()
+{
+    uint8_t src[N_BYTES];
+    for (uint32_t i = 0; i < N_BYTES; i++) src[i] = uint8_t(i * 7 + 1);
+    debug_write(SRC_ADDR, src, N_BYTES);
+    
+    // source, destination, length, next
+    uint32_t desc[N_DESC][4];
+    uint32_t chunk = N_BYTES / N_DESC;
+    for (uint32_t d = 0; d < N_DESC; d++)
+    {
+        desc[d][0] = SRC_ADDR + d * chunk;
+        desc[d][1] = DST_ADDR + d * chunk;
+        desc[d][2] = chunk;
+        desc[d][3] = (d + 1 < N_DESC) ? DESC_ADDR + (d + 1) * sizeof(desc[0]) : 0;
+    }
+    debug_write(DESC_ADDR, reinterpret_cast<uint8_t *>(desc), sizeof(desc));
+    
+    write_reg(dma::REG_BURST, burst);
+    
+    for (uint32_t run = 0; run < n_runs; run++)
+    {
+        write_reg(dma::REG_DESC, DESC_ADDR);
+        write_reg(dma::REG_CTRL, dma::CTRL_START | dma::CTRL_CHAIN | dma::CTRL_IRQ_EN);
+        
+        wait(irq.posedge_event());
+        write_reg(dma::REG_STATUS, dma::STATUS_DONE | dma::STATUS_ERROR);
+    }
+    
+    uint8_t dst[N_BYTES];
+    debug_read(DST_ADDR, dst, N_BYTES);
+    for (uint32_t i = 0; i < N_BYTES; i++)
+    {
+        if (dst[i] != src[i]) n_errors++;
+    }
+}
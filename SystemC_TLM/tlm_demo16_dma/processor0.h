@@ -0,0 +1,59 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo16_dma/processor0.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (DMA driver) module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo16_processor0_h_
+#define _tlm_demo16_processor0_h_
+
+#include "../tlm_demo2/processor.h"
+
+//------------------------------------------------------------------------------
+//! Core programming the DMA controller with a descriptor chain.
+//------------------------------------------------------------------------------
+class processor0 : public  processor
+{
+public:
+    
+    //! Address of the DMA registers.
+    enum { DMA_BASE = 0x10000 };
+    
+    //! Class Construct
+    //
+    //! @param name    SystemC module name
+    //! @param n_runs  Number of times the chain is executed
+    //! @param burst   Burst size of the DMA controller in bytes
+    processor0(sc_core::sc_module_name  name, uint32_t n_runs, uint32_t burst);
+    
+    //! Interrupt line of the DMA controller.
+    sc_core::sc_in<bool> irq;
+    
+    //! Number of wrong bytes at the destination.
+    uint32_t get_errors() const { return n_errors; }
+    
+private:
+    
+    //! SystemC Thread programming the DMA controller.
+    void program_main();
+    
+    //! Writes a DMA register.
+    void write_reg(uint32_t offset, uint32_t value);
+    
+    //! Number of times the chain is executed.
+    uint32_t n_runs;
+    
+    //! Burst size of the DMA controller in bytes.
+    uint32_t burst;
+    
+    //! Number of wrong bytes at the destination.
+    uint32_t n_errors;
+};
+
+#endif
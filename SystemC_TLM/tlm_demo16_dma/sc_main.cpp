@@ -0,0 +1,76 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo16_dma/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo16 (DMA controller)
+ *
+ * Usage: tlm_demo16_dma [dmi 0/1] [burst bytes] [runs]
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/router.h"
+#include "processor0.h"
+#include "dma.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo16
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    bool         use_dmi = (argc > 1) ? atoi(argv[1]) != 0 : true;
+    unsigned int burst   = (argc > 2) ? atoi(argv[2]) : 64;
+    unsigned int n_runs  = (argc > 3) ? atoi(argv[3]) : 1000;
+    
+    tlm::tlm_global_quantum::instance().set(sc_core::sc_time(1, sc_core::SC_US));
+    
+    //! Instantiate the modules
+    processor0       *i_cpu    = new processor0("i_cpu", n_runs, burst);
+    dma              *i_dma    = new dma("i_dma");
+    memory           *i_mem    = new memory("i_memory", false);
+    router<2, 2>     *i_router = new router<2, 2>("i_router");
+    
+    i_mem->dmi = use_dmi;
+    
+    //! Bind the sockets, memory at 0x0, DMA registers at 0x10000
+    i_cpu->data_bus.bind(i_router->target_socket[0]);
+    i_dma->data_bus.bind(i_router->target_socket[1]);
+    i_router->initiator_socket[0].bind(i_mem->data_bus);
+    i_router->initiator_socket[1].bind(i_dma->reg_bus);
+    i_router->map(0, 0x0, processor0::DMA_BASE);
+    i_router->map(1, processor0::DMA_BASE, 0x100);
+    
+    i_cpu->irq(i_dma->irq);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 16 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Bytes copied     : " << setw(10) << setfill(' ') << i_dma->get_bytes()        <<"             #"<<endl;
+    cout << "# Bytes over DMI   : " << setw(10) << setfill(' ') << i_dma->get_dmi_bytes()    <<"             #"<<endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << i_dma->get_transactions() <<"             #"<<endl;
+    cout << "# Descriptors      : " << setw(10) << setfill(' ') << i_dma->get_descriptors()  <<"             #"<<endl;
+    cout << "# Errors           : " << setw(10) << setfill(' ') << i_cpu->get_errors()       <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << sc_core::sc_time_stamp().to_seconds()*1e6 <<" us          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,94 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo17_timer/processor0.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (timer driver) module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor0.h"
+#include "timer.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor0 module
+//
+//! @param name      SystemC module name
+//! @param compare   Compare value, the period is compare + 1 counts
+//! @param n_irqs    Number of interrupts to wait for
+//! @param expected  Expected time between two interrupts
+//------------------------------------------------------------------------------
+processor0::processor0(sc_module_name  name,
+                       uint32_t        compare,
+                       uint32_t        n_irqs,
+                       const sc_time&  expected) :
+processor (name), irq("irq"), compare(compare), n_irqs(n_irqs),
+expected(expected), n_received(0), n_errors(0)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//! Reads a timer register through the bus.
+// -----------------------------------------------------------------------------
+uint32_t processor0::read_reg(uint32_t offset)
+{
+    uint32_t value = 0;
+    if(bus_readwrite(tlm::TLM_READ_COMMAND, TIMER_BASE + offset, 4,
+                     reinterpret_cast<uint8_t *>(&value), 0)
+       ){
+        cout << "     (cpu0) @ " << sc_time_stamp() << ", Read Failed.\n";
+    }
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+//! Writes a timer register through the bus.
+// -----------------------------------------------------------------------------
+void processor0::write_reg(uint32_t offset, uint32_t value)
+{
+    if(bus_readwrite(tlm::TLM_WRITE_COMMAND, TIMER_BASE + offset, 4,
+                     reinterpret_cast<uint8_t *>(&value), 0)
+       ){
+        cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+    }
+}
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread programming the timer.
+//
+// The timer counts from 0 to the compare value and raises its interrupt at
+// each match. The core sleeps until the interrupt, reads the counter as an
+// interrupt handler would and acknowledges the match. The time between two
+// interrupts is checked, then the timer is stopped so the simulation ends.
+// -----------------------------------------------------------------------------
+void processor0::program_main()
+{
+    write_reg(timer::REG_COMPARE, compare);
+    write_reg(timer::REG_CTRL, timer::CTRL_ENABLE | timer::CTRL_MATCH_IRQ |
+                               timer::CTRL_CLEAR_ON_MATCH);
+    
+    sc_time last = SC_ZERO_TIME;
+    for (uint32_t i = 0; i < n_irqs; i++)
+    {
+        wait(irq.posedge_event());
+        
+        if (i > 0 && sc_time_stamp() - last != expected) n_errors++;
+        last = sc_time_stamp();
+        n_received++;
+        
+        read_reg(timer::REG_COUNT);
+        write_reg(timer::REG_STATUS, timer::STATUS_MATCH);
+    }
+    
+    write_reg(timer::REG_CTRL, 0);
+}
@@ -0,0 +1,70 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo17_timer/processor0.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 (timer driver) module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo17_processor0_h_
+#define _tlm_demo17_processor0_h_
+
+#include "../tlm_demo2/processor.h"
+
+//------------------------------------------------------------------------------
+//! Core running a periodic timer interrupt.
+//------------------------------------------------------------------------------
+class processor0 : public  processor
+{
+public:
+    
+    //! Address of the timer registers.
+    enum { TIMER_BASE = 0x20000 };
+    
+    //! Class Construct
+    //
+    //! @param name      SystemC module name
+    //! @param compare   Compare value, the period is compare + 1 counts
+    //! @param n_irqs    Number of interrupts to wait for
+    //! @param expected  Expected time between two interrupts
+    processor0(sc_core::sc_module_name  name,
+               uint32_t                 compare,
+               uint32_t                 n_irqs,
+               const sc_core::sc_time&  expected);
+    
+    //! Interrupt line of the timer.
+    sc_core::sc_in<bool> irq;
+    
+    //! Number of interrupts received.
+    uint32_t get_irqs() const { return n_received; }
+    
+    //! Number of interrupts not at the expected time.
+    uint32_t get_errors() const { return n_errors; }
+    
+private:
+    
+    //! SystemC Thread programming the timer.
+    void program_main();
+    
+    //! Reads and writes a timer register.
+    uint32_t read_reg(uint32_t offset);
+    void write_reg(uint32_t offset, uint32_t value);
+    
+    //! Compare value.
+    uint32_t compare;
+    
+    //! Number of interrupts to wait for.
+    uint32_t n_irqs;
+    
+    //! Expected time between two interrupts.
+    sc_core::sc_time expected;
+    
+    //! Statistics.
+    uint32_t n_received, n_errors;
+};
+
+#endif
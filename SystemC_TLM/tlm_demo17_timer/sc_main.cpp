@@ -0,0 +1,70 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo17_timer/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo17 (timer/counter)
+ *
+ * Usage: tlm_demo17_timer [tick ns] [compare] [interrupts]
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo3_sync/router.h"
+#include "processor0.h"
+#include "timer.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo17
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    double       t_tick  = (argc > 1) ? atof(argv[1]) : 1;
+    unsigned int compare = (argc > 2) ? atoi(argv[2]) : 9999;
+    unsigned int n_irqs  = (argc > 3) ? atoi(argv[3]) : 1000;
+    
+    sc_core::sc_time tick(t_tick, sc_core::SC_NS);
+    
+    //! Instantiate the modules
+    processor0    *i_cpu    = new processor0("i_cpu", compare, n_irqs,
+                                             tick * (double(compare) + 1));
+    timer         *i_timer  = new timer("i_timer", tick);
+    router<1, 1>  *i_router = new router<1, 1>("i_router");
+    
+    //! Bind the sockets, timer registers at 0x20000
+    i_cpu->data_bus.bind(i_router->target_socket[0]);
+    i_router->initiator_socket[0].bind(i_timer->reg_bus);
+    i_router->map(0, processor0::TIMER_BASE, 0x100);
+    
+    i_cpu->irq(i_timer->irq);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double ticks  = sc_core::sc_time_stamp() / tick;
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 17 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Interrupts       : " << setw(10) << setfill(' ') << i_cpu->get_irqs()      <<"             #"<<endl;
+    cout << "# Errors           : " << setw(10) << setfill(' ') << i_cpu->get_errors()    <<"             #"<<endl;
+    cout << "# Timer ticks      : " << setw(10) << setfill(' ') << ticks                  <<"             #"<<endl;
+    cout << "# Timer events     : " << setw(10) << setfill(' ') << i_timer->get_events()  <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << sc_core::sc_time_stamp().to_seconds()*1e6 <<" us          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,303 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo17_timer/timer.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Timer/counter module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "timer.h"
+
+SC_HAS_PROCESS( timer );
+
+using namespace sc_core;
+
+//! Number of counts of a full 32-bit cycle.
+static const sc_dt::uint64 WRAP = sc_dt::uint64(1) << 32;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the timer
+//
+//! @param name  SystemC module name
+//! @param tick  Resolution of the counter
+//------------------------------------------------------------------------------
+timer::timer(sc_module_name name, const sc_time& tick) :
+reg_bank (name, 0x20), irq("irq"), tick(tick), period(tick),
+base_count(0), base_time(SC_ZERO_TIME), match_pending(false),
+match_interval(WRAP), ovf_pending(false), ovf_repeat(false), n_events(0)
+{
+    if (tick == SC_ZERO_TIME)
+    {
+        SC_REPORT_ERROR("timer", "the tick must not be zero");
+    }
+
+    latency = sc_time(5, SC_NS);
+
+    // all writes restart the counting, the values are stored by write_config
+    const uint32_t config[] = { REG_CTRL, REG_PRESCALE, REG_COMPARE };
+    for (unsigned int i = 0; i < sizeof(config) / sizeof(config[0]); i++)
+    {
+        uint32_t offset = config[i];
+        add_register(offset, 4, (offset == REG_COMPARE) ? 0xFFFFFFFF : 0, 0,
+                     read_callback(),
+                     [this, offset](uint32_t data, sc_time& delay) {
+                         write_config(offset, data, sc_time_stamp() + delay);
+                     });
+    }
+    add_register(REG_COUNT, 4, 0, 0,
+                 [this](const sc_time& delay) {
+                     return read_count(sc_time_stamp() + delay);
+                 },
+                 [this](uint32_t data, sc_time& delay) {
+                     write_config(REG_COUNT, data, sc_time_stamp() + delay);
+                 });
+    add_register(REG_STATUS, 4, 0, 0,
+                 [this](const sc_time& delay) {
+                     return read_status(sc_time_stamp() + delay);
+                 },
+                 [this](uint32_t data, sc_time& delay) {
+                     write_status(data, sc_time_stamp() + delay);
+                 });
+
+    // both reads only compute the value, debug reads see it as well
+    set_peek(REG_COUNT,  [this](const sc_time&) { return count_at(sc_time_stamp()); });
+    set_peek(REG_STATUS, [this](const sc_time&) { return status_at(sc_time_stamp()); });
+
+    SC_METHOD(expire_method);
+    sensitive << expire;
+    dont_initialize();
+
+    SC_METHOD(irq_method);
+    sensitive << irq_update;
+    dont_initialize();
+}
+
+
+//------------------------------------------------------------------------------
+//! The SystemC method at the next match or overflow with an interrupt.
+//------------------------------------------------------------------------------
+void timer::expire_method()
+{
+    n_events++;
+
+    update(sc_time_stamp());
+    update_irq();
+    schedule();
+}
+
+
+//------------------------------------------------------------------------------
+//! Value of the counter at time now, computed from the last restart.
+//------------------------------------------------------------------------------
+uint32_t timer::count_at(const sc_time& now)
+{
+    if (!(reg(REG_CTRL) & CTRL_ENABLE) || now <= base_time) return base_count;
+
+    sc_dt::uint64 counts = (now - base_time).value() / period.value();
+
+    if (!(reg(REG_CTRL) & CTRL_CLEAR_ON_MATCH))
+    {
+        return uint32_t(base_count + counts);
+    }
+
+    // counts up to COMPARE, or first up to the wrap if started above it
+    sc_dt::uint64 modulo = sc_dt::uint64(reg(REG_COMPARE)) + 1;
+    if (base_count < modulo)
+    {
+        return uint32_t((base_count + counts) % modulo);
+    }
+    sc_dt::uint64 to_wrap = WRAP - base_count;
+    return (counts < to_wrap) ? uint32_t(base_count + counts)
+                              : uint32_t((counts - to_wrap) % modulo);
+}
+
+
+//------------------------------------------------------------------------------
+//! Sets MATCH and OVF for the matches and overflows up to time now and moves
+//! the next match and overflow past now.
+//------------------------------------------------------------------------------
+void timer::update(const sc_time& now)
+{
+    if (match_pending && t_match <= now)
+    {
+        reg(REG_STATUS) |= STATUS_MATCH;
+
+        sc_time       step = period * double(match_interval);
+        sc_dt::uint64 n    = (now - t_match).value() / step.value() + 1;
+        t_match += step * double(n);
+    }
+
+    if (ovf_pending && t_ovf <= now)
+    {
+        reg(REG_STATUS) |= STATUS_OVF;
+
+        if (ovf_repeat)
+        {
+            sc_time       step = period * double(WRAP);
+            sc_dt::uint64 n    = (now - t_ovf).value() / step.value() + 1;
+            t_ovf += step * double(n);
+        }
+        else
+        {
+            ovf_pending = false;
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Computes the next match and overflow from ::base_count at ::base_time.
+//------------------------------------------------------------------------------
+void timer::arm()
+{
+    uint32_t ctrl = reg(REG_CTRL);
+
+    period        = tick * double(sc_dt::uint64(reg(REG_PRESCALE)) + 1);
+    match_pending = false;
+    ovf_pending   = false;
+    if (!(ctrl & CTRL_ENABLE)) return;
+
+    bool          clear = (ctrl & CTRL_CLEAR_ON_MATCH) != 0;
+    sc_dt::uint64 count = base_count;
+    sc_dt::uint64 cmp   = reg(REG_COMPARE);
+
+    match_interval = clear ? cmp + 1 : WRAP;
+
+    sc_dt::uint64 to_match = (cmp > count) ? cmp - count : WRAP - count + cmp;
+    if (cmp == count) to_match = match_interval;
+
+    match_pending = true;
+    t_match       = base_time + period * double(to_match);
+
+    if (!clear || count > cmp)
+    {
+        ovf_pending = true;
+        ovf_repeat  = !clear;
+        t_ovf       = base_time + period * double(WRAP - count);
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Replaces the pending notification of ::expire by the one for the next
+//! match or overflow whose interrupt is enabled, if any.
+//------------------------------------------------------------------------------
+void timer::schedule()
+{
+    expire.cancel();
+
+    uint32_t ctrl  = reg(REG_CTRL);
+    bool     match = match_pending && (ctrl & CTRL_MATCH_IRQ);
+    bool     ovf   = ovf_pending   && (ctrl & CTRL_OVF_IRQ);
+    if (!match && !ovf) return;
+
+    sc_time t = match ? t_match : t_ovf;
+    if (match && ovf && t_ovf < t) t = t_ovf;
+
+    sc_time now = sc_time_stamp();
+    expire.notify((t > now) ? t - now : SC_ZERO_TIME);
+}
+
+
+//------------------------------------------------------------------------------
+//! Requests an update of ::irq in the next delta cycle.
+//------------------------------------------------------------------------------
+void timer::update_irq()
+{
+    irq_update.notify(SC_ZERO_TIME);
+}
+
+
+//------------------------------------------------------------------------------
+//! The SystemC method setting ::irq from the STATUS bits with an enabled
+//! interrupt.
+//------------------------------------------------------------------------------
+void timer::irq_method()
+{
+    uint32_t ctrl   = reg(REG_CTRL);
+    uint32_t status = reg(REG_STATUS);
+
+    irq.write(((status & STATUS_MATCH) && (ctrl & CTRL_MATCH_IRQ)) ||
+              ((status & STATUS_OVF)   && (ctrl & CTRL_OVF_IRQ)));
+}
+
+
+//------------------------------------------------------------------------------
+//! STATUS including the matches and overflows up to time now. The flags are
+//! only computed, they are set in STATUS by update() at the next write or
+//! ::expire, so reading STATUS, also by a debug read, changes nothing.
+//------------------------------------------------------------------------------
+uint32_t timer::status_at(const sc_time& now)
+{
+    uint32_t status = reg(REG_STATUS);
+    if (match_pending && t_match <= now) status |= STATUS_MATCH;
+    if (ovf_pending   && t_ovf   <= now) status |= STATUS_OVF;
+    return status;
+}
+
+
+//------------------------------------------------------------------------------
+//! Write callback of CTRL, PRESCALE, COUNT and COMPARE.
+//
+//! The counting is restarted at time now from the value reached with the old
+//! configuration, or from the value written to COUNT.
+//
+//! @param offset  The register written
+//! @param data    The data written
+//! @param now     The time of the write
+//------------------------------------------------------------------------------
+void timer::write_config(uint32_t offset, uint32_t data, const sc_time& now)
+{
+    update(now);
+
+    base_count = count_at(now);
+    base_time  = now;
+
+    // the bytes not written keep their value
+    if (offset == REG_COUNT)
+        base_count = merge_write(base_count, data);
+    else if (offset == REG_CTRL)
+        reg(offset) = merge_write(reg(offset), data) &
+                      (CTRL_ENABLE | CTRL_MATCH_IRQ | CTRL_OVF_IRQ | CTRL_CLEAR_ON_MATCH);
+    else
+        reg(offset) = merge_write(reg(offset), data);
+
+    arm();
+    schedule();
+    update_irq();
+}
+
+
+//------------------------------------------------------------------------------
+//! Write callback of STATUS, a 1 clears MATCH or OVF.
+//------------------------------------------------------------------------------
+void timer::write_status(uint32_t data, const sc_time& now)
+{
+    update(now);
+    reg(REG_STATUS) &= ~(data & (STATUS_MATCH | STATUS_OVF));
+    schedule();
+    update_irq();
+}
+
+
+//------------------------------------------------------------------------------
+//! Read callback of COUNT.
+//------------------------------------------------------------------------------
+uint32_t timer::read_count(const sc_time& now)
+{
+    return count_at(now);
+}
+
+
+//------------------------------------------------------------------------------
+//! Read callback of STATUS, includes the matches and overflows up to now.
+//------------------------------------------------------------------------------
+uint32_t timer::read_status(const sc_time& now)
+{
+    return status_at(now);
+}
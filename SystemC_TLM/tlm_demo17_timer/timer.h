@@ -0,0 +1,137 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo17_timer/timer.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Timer/counter module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo17_timer_h_
+#define _tlm_demo17_timer_h_
+
+#include "systemc"
+#include "tlm.h"
+#include "../tlm_demo2/reg_bank.h"
+
+
+//------------------------------------------------------------------------------
+//! 32-bit timer/counter without a process per tick.
+//
+//! Register map, 32-bit registers of a reg_bank, the address is taken modulo 32:
+//! - 0x00 CTRL      bit 0 enable, bit 1 match interrupt, bit 2 overflow
+//!                  interrupt, bit 3 clear the counter on a compare match
+//! - 0x04 PRESCALE  the counter advances every PRESCALE + 1 ticks
+//! - 0x08 COUNT     the counter, writable
+//! - 0x0C COMPARE   MATCH is set when the counter reaches this value
+//! - 0x10 STATUS    bit 0 match, bit 1 overflow, write 1 to clear
+//
+//! The counter is not stored per tick. A write to a register restarts the
+//! counting from the current value at the time of the write, and COUNT is
+//! computed on read from the time of the read, sc_time_stamp() plus the local
+//! time offset of the initiator. STATUS is updated on read the same way.
+//
+//! Only one ::expire notification is pending, for the next compare match or
+//! overflow whose interrupt is enabled, and it raises ::irq. The register
+//! callbacks run in the process of the initiator, so they do not write ::irq
+//! but notify ::irq_method, the only writer of the signal. A stopped timer,
+//! or one without enabled interrupts, causes no kernel activity whatever the
+//! tick resolution is.
+//
+//! With clear on match the counter counts from 0 to COMPARE, no overflow is
+//! set unless it was started above COMPARE.
+//------------------------------------------------------------------------------
+class timer : public reg_bank
+{
+public:
+
+    //! Register offsets.
+    enum { REG_CTRL = 0x00, REG_PRESCALE = 0x04, REG_COUNT = 0x08,
+           REG_COMPARE = 0x0C, REG_STATUS = 0x10 };
+
+    //! Bits of the CTRL register.
+    enum { CTRL_ENABLE = 0x1, CTRL_MATCH_IRQ = 0x2, CTRL_OVF_IRQ = 0x4,
+           CTRL_CLEAR_ON_MATCH = 0x8 };
+
+    //! Bits of the STATUS register.
+    enum { STATUS_MATCH = 0x1, STATUS_OVF = 0x2 };
+
+    //! Class Construct
+    timer(sc_core::sc_module_name name, const sc_core::sc_time& tick);
+
+    //! Interrupt line, high while an enabled STATUS bit is set.
+    sc_core::sc_signal<bool> irq;
+
+    //! Number of ::expire notifications, the kernel activity of the timer.
+    sc_dt::uint64 get_events() const { return n_events; }
+
+private:
+
+    //! SystemC method raising the interrupt at a match or an overflow.
+    void expire_method();
+
+    //! SystemC method driving ::irq, its only writer.
+    void irq_method();
+
+    //! Value of the counter at time now.
+    uint32_t count_at(const sc_core::sc_time& now);
+
+    //! Sets MATCH and OVF for the matches and overflows up to time now.
+    void update(const sc_core::sc_time& now);
+
+    //! Computes the next match and overflow after a restart.
+    void arm();
+
+    //! Notifies ::expire for the next match or overflow with an interrupt.
+    void schedule();
+
+    //! Requests ::irq_method to set ::irq from STATUS and CTRL.
+    void update_irq();
+
+    //! STATUS with the matches and overflows up to time now, no state changes.
+    uint32_t status_at(const sc_core::sc_time& now);
+
+    //! Write callback of CTRL, PRESCALE, COUNT and COMPARE.
+    void write_config(uint32_t offset, uint32_t data, const sc_core::sc_time& now);
+
+    //! Write callback of STATUS, clears the bits written 1.
+    void write_status(uint32_t data, const sc_core::sc_time& now);
+
+    //! Read callbacks of COUNT and STATUS.
+    uint32_t read_count(const sc_core::sc_time& now);
+    uint32_t read_status(const sc_core::sc_time& now);
+
+    //! Resolution of the counter.
+    sc_core::sc_time tick;
+
+    //! Time of one count, tick * (PRESCALE + 1).
+    sc_core::sc_time period;
+
+    //! Counter value at the restart and the time of the restart.
+    uint32_t          base_count;
+    sc_core::sc_time  base_time;
+
+    //! Time of the next match and counts between two matches.
+    bool              match_pending;
+    sc_core::sc_time  t_match;
+    sc_dt::uint64     match_interval;
+
+    //! Time of the next overflow, repeated without clear on match.
+    bool              ovf_pending;
+    bool              ovf_repeat;
+    sc_core::sc_time  t_ovf;
+
+    //! Next match or overflow with an interrupt.
+    sc_core::sc_event expire;
+
+    //! Notified when STATUS or CTRL changed, wakes ::irq_method.
+    sc_core::sc_event irq_update;
+
+    //! Statistics.
+    sc_dt::uint64 n_events;
+};
+
+#endif
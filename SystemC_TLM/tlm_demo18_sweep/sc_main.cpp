@@ -0,0 +1,316 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo18_sweep/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Parallel parameter sweep of the TLM_demo3 (decop) platform
+ *
+ * Usage: tlm_demo18_sweep [quanta ns] [latencies ns] [core pairs]
+ *                         [simulated time ns] [jobs]
+ *
+ * The lists are comma separated, e.g.
+ *   tlm_demo18_sweep 20,200,2000 5,20 1,2,4 100000 8
+ *
+ * Only one SystemC kernel can run per process, so every point of the sweep
+ * runs in a process of its own. The platform is constructed and bound once
+ * per number of cores in a group process, which then forks one worker per
+ * quantum and latency. A fork before sc_start() copies the module hierarchy,
+ * no process of the kernel exists yet. The rest of the elaboration, i.e. the
+ * binding checks, the elaboration callbacks and the creation of the
+ * processes, and the initialization run in every worker at its sc_start(),
+ * since the quantum and latency are set just before. The workers send their
+ * metrics through a pipe and the main process prints them as one table.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <chrono>
+#include <sstream>
+#include <vector>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/speed_monitor.h"
+#include "../tlm_demo3_decop/processor0.h"
+#include "../tlm_demo3_decop/processor1.h"
+#include "../tlm_demo3_sync/router.h"
+
+using namespace std;
+
+//! Maximal number of producer/consumer core pairs.
+static const unsigned int MAX_PAIRS = 8;
+
+
+//------------------------------------------------------------------------------
+//! Initiator without traffic, binds the unused router ports.
+//------------------------------------------------------------------------------
+class idle_initiator : public sc_core::sc_module
+{
+public:
+    idle_initiator(sc_core::sc_module_name name) : sc_module(name), socket("socket") {}
+
+    tlm_utils::simple_initiator_socket<idle_initiator> socket;
+};
+
+
+//------------------------------------------------------------------------------
+//! Metrics of one point of the sweep, written to the pipe by a worker.
+//------------------------------------------------------------------------------
+struct sweep_result
+{
+    unsigned int   index;         //!< Index of the point
+    double         t_cpu;         //!< Host CPU seconds of sc_start()
+    double         t_sim;         //!< Simulated seconds
+    sc_dt::uint64  transactions;  //!< Memory transactions
+    sc_dt::uint64  instructions;  //!< Retired instructions
+    sc_dt::uint64  syncs;         //!< Quantum syncs
+};
+
+
+//------------------------------------------------------------------------------
+//! Parses a comma separated list of numbers.
+//------------------------------------------------------------------------------
+static vector<double> parse_list(const char* arg)
+{
+    vector<double> values;
+    stringstream   ss(arg);
+    string         item;
+    while (getline(ss, item, ','))
+    {
+        if (!item.empty()) values.push_back(atof(item.c_str()));
+    }
+    return values;
+}
+
+
+//------------------------------------------------------------------------------
+//! Waits for one child process, returns false if there is none.
+//------------------------------------------------------------------------------
+static bool wait_child()
+{
+    int status;
+    return wait(&status) > 0;
+}
+
+
+// -----------------------------------------------------------------------------
+//! Group process: constructs the platform with n_pairs producer/consumer
+//! pairs, then runs the points of the group in forked workers, at most slots
+//! at a time. Each worker completes the elaboration in its sc_start().
+// -----------------------------------------------------------------------------
+static void run_group(unsigned int                n_pairs,
+                      const vector<unsigned int>& points,
+                      const vector<double>&       quanta,
+                      const vector<double>&       latencies,
+                      double                      t_sim,
+                      unsigned int                slots,
+                      int                         result_fd)
+{
+    //! Construct the platform: all cores share the memory through the router,
+    //! no model logs, so the measured host time is the simulation alone
+    router<2 * MAX_PAIRS, 1> *i_router = new router<2 * MAX_PAIRS, 1>("i_router");
+    memory                   *i_mem    = new memory("i_memory", false);
+    i_router->initiator_socket[0].bind(i_mem->data_bus);
+    i_router->map(0, 0, sc_dt::uint64(1) << 32);
+
+    for (unsigned int p = 0; p < MAX_PAIRS; p++)
+    {
+        ostringstream n0, n1;
+        if (p < n_pairs)
+        {
+            n0 << "i_cpu0_" << p;
+            n1 << "i_cpu1_" << p;
+            processor0 *i_cpu0 = new processor0(n0.str().c_str(), false);
+            processor1 *i_cpu1 = new processor1(n1.str().c_str(), false);
+            i_cpu0->data_bus.bind(i_router->target_socket[2 * p]);
+            i_cpu1->data_bus.bind(i_router->target_socket[2 * p + 1]);
+        }
+        else
+        {
+            n0 << "i_idle0_" << p;
+            n1 << "i_idle1_" << p;
+            idle_initiator *i_idle0 = new idle_initiator(n0.str().c_str());
+            idle_initiator *i_idle1 = new idle_initiator(n1.str().c_str());
+            i_idle0->socket.bind(i_router->target_socket[2 * p]);
+            i_idle1->socket.bind(i_router->target_socket[2 * p + 1]);
+        }
+    }
+
+    //! Fork a worker per point, the constructed modules are copied
+    unsigned int running = 0;
+    for (size_t i = 0; i < points.size(); i++)
+    {
+        if (running == slots && wait_child()) running--;
+
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            break;
+        }
+        if (pid > 0)
+        {
+            running++;
+            continue;
+        }
+
+        // worker: the cores are built without logging, the remaining console
+        // output of the models is discarded
+        int null_fd = open("/dev/null", O_WRONLY);
+        if (null_fd >= 0) dup2(null_fd, STDOUT_FILENO);
+
+        unsigned int index   = points[i];
+        double       quantum = quanta[index % quanta.size()];
+        double       latency = latencies[(index / quanta.size()) % latencies.size()];
+
+        tlm::tlm_global_quantum::instance().set(sc_core::sc_time(quantum, sc_core::SC_NS));
+        i_mem->timing.read_delay  = sc_core::sc_time(latency, sc_core::SC_NS);
+        i_mem->timing.write_delay = sc_core::sc_time(latency, sc_core::SC_NS);
+
+        int t_start=clock();
+        sc_core::sc_start(t_sim, sc_core::SC_NS);
+        int t_stop=clock();
+
+        speed_counters& c = speed_counters::instance();
+        sweep_result r;
+        r.index        = index;
+        r.t_cpu        = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+        r.t_sim        = sc_core::sc_time_stamp().to_seconds();
+        r.transactions = c.n_transactions.load();
+        r.instructions = c.n_instructions.load();
+        r.syncs        = c.n_syncs.load();
+
+        // smaller than PIPE_BUF, the write is atomic
+        if (write(result_fd, &r, sizeof(r)) != sizeof(r)) _exit(1);
+        _exit(0);
+    }
+
+    while (wait_child()) {}
+    _exit(0);
+}
+
+
+// -----------------------------------------------------------------------------
+//! main program to execute the TLM_demo18 sweep
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    vector<double> quanta    = parse_list((argc > 1) ? argv[1] : "20,200,2000");
+    vector<double> latencies = parse_list((argc > 2) ? argv[2] : "5,20");
+    vector<double> pairs     = parse_list((argc > 3) ? argv[3] : "1,2,4");
+    double         t_sim     = (argc > 4) ? atof(argv[4]) : 100000;
+    long           jobs      = (argc > 5) ? atol(argv[5]) : sysconf(_SC_NPROCESSORS_ONLN);
+
+    if (quanta.empty() || latencies.empty() || pairs.empty() || jobs < 1)
+    {
+        cerr << "Usage: " << argv[0] << " [quanta ns] [latencies ns] [core pairs]"
+             << " [simulated time ns] [jobs]" << endl;
+        return 1;
+    }
+
+    //! Points, index = quantum + latency * n_quanta + pairs * n_quanta * n_latencies
+    unsigned int per_group = quanta.size() * latencies.size();
+    unsigned int n_points  = per_group * pairs.size();
+    unsigned int slots     = max(1u, unsigned(jobs / pairs.size()));
+
+    int fds[2];
+    if (pipe(fds) != 0)
+    {
+        perror("pipe");
+        return 1;
+    }
+
+    int t_start=clock();
+    chrono::steady_clock::time_point w_start = chrono::steady_clock::now();
+
+    //! Fork a group per number of cores, the groups run concurrently
+    for (size_t g = 0; g < pairs.size(); g++)
+    {
+        unsigned int n_pairs = unsigned(pairs[g]);
+        if (n_pairs < 1 || n_pairs > MAX_PAIRS)
+        {
+            cerr << "Core pairs must be between 1 and " << MAX_PAIRS << endl;
+            continue;
+        }
+
+        vector<unsigned int> points;
+        for (unsigned int i = 0; i < per_group; i++) points.push_back(g * per_group + i);
+
+        pid_t pid = fork();
+        if (pid < 0)
+        {
+            perror("fork");
+            break;
+        }
+        if (pid == 0)
+        {
+            close(fds[0]);
+            run_group(n_pairs, points, quanta, latencies, t_sim, slots, fds[1]);
+        }
+    }
+    close(fds[1]);
+
+    //! Collect the results until all workers closed the pipe
+    vector<sweep_result> results(n_points);
+    vector<bool>         valid(n_points, false);
+    sweep_result         r;
+    while (read(fds[0], &r, sizeof(r)) == sizeof(r))
+    {
+        if (r.index < n_points)
+        {
+            results[r.index] = r;
+            valid[r.index]   = true;
+        }
+    }
+    close(fds[0]);
+    while (wait_child()) {}
+
+    double t_cpu  = (clock()-t_start)/double(CLOCKS_PER_SEC);
+    double t_wall = chrono::duration<double>(chrono::steady_clock::now() - w_start).count();
+
+
+    //! print the table, one row per point
+    cout << setw(10) << "quantum" << setw(10) << "latency" << setw(7) << "cores"
+         << setw(12) << "cpu s" << setw(12) << "sim/host" << setw(14) << "txn"
+         << setw(14) << "instr" << setw(12) << "syncs" << setw(10) << "MIPS" << endl;
+
+    for (unsigned int i = 0; i < n_points; i++)
+    {
+        cout << setw(10) << quanta[i % quanta.size()]
+             << setw(10) << latencies[(i / quanta.size()) % latencies.size()]
+             << setw(7)  << 2 * unsigned(pairs[i / per_group]);
+        if (!valid[i])
+        {
+            cout << setw(12) << "failed" << endl;
+            continue;
+        }
+        const sweep_result& p = results[i];
+        double host = (p.t_cpu > 0) ? p.t_cpu : 1e-9;
+        cout << setw(12) << p.t_cpu
+             << setw(12) << p.t_sim / host
+             << setw(14) << p.transactions
+             << setw(14) << p.instructions
+             << setw(12) << p.syncs
+             << setw(10) << p.instructions / host / 1e6 << endl;
+    }
+
+
+    // print sweep performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 18 : Sweep Complete.             #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Points           : " << setw(10) << setfill(' ') << n_points  <<"             #"<<endl;
+    cout << "# Parallel jobs    : " << setw(10) << setfill(' ') << slots * pairs.size() <<"             #"<<endl;
+    cout << "# Elapsed time     : " << setw(10) << setfill(' ') << t_wall    <<" s           #"<< endl;
+    cout << "# Main CPU time    : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
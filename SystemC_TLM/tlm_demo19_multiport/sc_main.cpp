@@ -0,0 +1,123 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo19_multiport/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo19 (multi-port memory)
+ *
+ * Usage: tlm_demo19_multiport [shared|direct] [remote delay ns] [transactions]
+ *
+ * Four traffic generators access a banked memory. In the shared mode they go
+ * through a router onto the one port of the memory, all accesses compete for
+ * the same banks. In the direct mode every generator is bound to a port of
+ * its own, the ports are independent channels, and each port has one local
+ * bank: accesses to the other banks pay the remote delay.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include <sstream>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/router.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+
+using namespace std;
+
+//! Number of traffic generators.
+static const unsigned int N_GENERATORS = 4;
+
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo19
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    string       mode         = (argc > 1) ? argv[1] : "direct";
+    double       remote_delay = (argc > 2) ? atof(argv[2]) : 2;
+    uint64_t     n_trans      = (argc > 3) ? atoll(argv[3]) : 100000;
+    bool         direct       = (mode != "shared");
+    
+    traffic_config config;
+    config.pattern        = PATTERN_RANDOM;
+    config.base_addr      = 0x00000000;
+    config.range          = 256;
+    config.access_size    = 4;
+    config.outstanding    = 4;
+    config.n_transactions = n_trans;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    //! Instantiate the modules, one port per generator in the direct mode
+    memory *i_mem = new memory("i_memory", false, direct ? N_GENERATORS : 1);
+    router<N_GENERATORS, 1> *i_router = 0;
+    if (!direct)
+    {
+        i_router = new router<N_GENERATORS, 1>("i_router");
+        i_router->initiator_socket[0].bind(i_mem->data_bus);
+        i_router->map(0, 0, sc_dt::uint64(1) << 32);
+    }
+    
+    vector<traffic_generator*> i_gen;
+    for (unsigned int i = 0; i < N_GENERATORS; i++)
+    {
+        ostringstream gen_name;
+        gen_name << "i_gen" << i;
+        config.seed = i + 1;
+        i_gen.push_back(new traffic_generator(gen_name.str().c_str(), config));
+        
+        //! Bind the TLM ports
+        if (direct)
+        {
+            i_gen[i]->data_bus.bind(i_mem->port(i));
+            
+            //! Bank i of the four cache line banks is local to port i
+            port_affinity& a = i_mem->affinity(i);
+            a.n_banks      = 4;
+            a.interleave   = banked_timing::CACHE_LINE;
+            a.local_banks  = 1u << i;
+            a.remote_delay = sc_core::sc_time(remote_delay, sc_core::SC_NS);
+        }
+        else
+        {
+            i_gen[i]->data_bus.bind(i_router->target_socket[i]);
+        }
+    }
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    sc_dt::uint64 n_conflicts = 0, n_remote = 0, n_total = 0;
+    for (unsigned int p = 0; p < i_mem->get_ports(); p++)
+    {
+        n_conflicts += i_mem->port_timing(p).get_conflicts();
+        n_remote    += i_mem->get_remote_accesses(p);
+    }
+    for (unsigned int i = 0; i < N_GENERATORS; i++) n_total += i_gen[i]->get_transactions();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 19 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Memory ports     : " << setw(10) << setfill(' ') << i_mem->get_ports() <<"             #"<<endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << n_total     <<"             #"<<endl;
+    cout << "# Bank conflicts   : " << setw(10) << setfill(' ') << n_conflicts <<"             #"<<endl;
+    cout << "# Remote accesses  : " << setw(10) << setfill(' ') << n_remote    <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e9   <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9   <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,180 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/causality_tracker.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Ordering of decoupled accesses to shared memory regions
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_causality_tracker_h_
+#define _tlm_demo2_causality_tracker_h_
+
+#include <vector>
+#include "systemc"
+
+
+//------------------------------------------------------------------------------
+//! Tracks the order of accesses to shared regions under temporal decoupling.
+//
+//! With temporal decoupling each initiator runs ahead on its local time, so
+//! the accesses arrive at a target in host order, not in the order of their
+//! time stamps, SystemC time plus the annotated delay. Only the regions
+//! declared with declare() are tracked. They are divided into granules, e.g.
+//! cache lines or pages, and each granule keeps the time stamps of the last
+//! write and the last read.
+//
+//! - A read with a time stamp before the last write of its granule arrives
+//!   from the past: it sees data written in its future. read() returns how
+//!   far the read lies behind the write, the target can then synchronize the
+//!   initiator up to the write (policy SYNC) or only count the violation
+//!   (policy FLAG).
+//! - A write with a time stamp before the last read of its granule comes too
+//!   late: the read has already returned the old data. It can not be undone,
+//!   write() counts it as a stale read.
+//
+//! An access of several bytes is checked against every granule it spans and
+//! counts at most one event. The accesses of one initiator are in time stamp
+//! order, so every event counted involves two initiators. Accesses outside
+//! the declared regions cost one compare per region and byte.
+//------------------------------------------------------------------------------
+class causality_tracker
+{
+public:
+
+    //! Reaction to a read from the past.
+    enum policy_e { FLAG, SYNC };
+
+    causality_tracker()
+    : policy(FLAG), n_violations(0), n_syncs(0), n_stale(0) {}
+
+    //--------------------------------------------------------------------------
+    //! Declares a shared region, its granules start without accesses.
+    //
+    //! @param start        First address of the region
+    //! @param bytes        Size of the region in bytes
+    //! @param granularity  Size of a granule in bytes, e.g. a cache line
+    //--------------------------------------------------------------------------
+    void declare(sc_dt::uint64 start, sc_dt::uint64 bytes, sc_dt::uint64 granularity)
+    {
+        region r;
+        r.start   = start;
+        r.bytes   = bytes;
+        r.granule = granularity ? granularity : 1;
+        r.last_write.assign((bytes + r.granule - 1) / r.granule, sc_core::SC_ZERO_TIME);
+        r.last_read.assign(r.last_write.size(), sc_core::SC_ZERO_TIME);
+        regions.push_back(r);
+    }
+
+    //! True if any region is declared.
+    bool active() const { return !regions.empty(); }
+
+    //--------------------------------------------------------------------------
+    //! Records a read and checks it against the last writes of its granules.
+    //
+    //! @param addr  The address of the read
+    //! @param len   The number of bytes read
+    //! @param t     Its time stamp, SystemC time plus the annotated delay
+    //
+    //! @return  How far the read lies before the latest of the last writes,
+    //!          zero if ordered
+    //--------------------------------------------------------------------------
+    sc_core::sc_time read(sc_dt::uint64 addr, unsigned int len, const sc_core::sc_time& t)
+    {
+        sc_core::sc_time latest = t;
+        each_granule(addr, len, [&](region& r, size_t g) {
+            if (r.last_write[g] > latest) latest = r.last_write[g];
+        });
+
+        sc_core::sc_time behind = latest - t;
+        sc_core::sc_time t_read = t;
+        if (behind != sc_core::SC_ZERO_TIME)
+        {
+            n_violations++;
+            if (policy == SYNC)
+            {
+                t_read = latest;
+                n_syncs++;
+            }
+        }
+        each_granule(addr, len, [&](region& r, size_t g) {
+            if (t_read > r.last_read[g]) r.last_read[g] = t_read;
+        });
+        return behind;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Records a write and checks it against the last reads of its granules.
+    //
+    //! @param addr  The address of the write
+    //! @param len   The number of bytes written
+    //! @param t     Its time stamp, SystemC time plus the annotated delay
+    //--------------------------------------------------------------------------
+    void write(sc_dt::uint64 addr, unsigned int len, const sc_core::sc_time& t)
+    {
+        bool stale = false;
+        each_granule(addr, len, [&](region& r, size_t g) {
+            if (r.last_read[g] > t) stale = true;
+            if (t > r.last_write[g]) r.last_write[g] = t;
+        });
+        if (stale) n_stale++;
+    }
+
+    //! Reaction to a read from the past.
+    policy_e policy;
+
+    //! Reads from the past of a write.
+    sc_dt::uint64 get_violations() const { return n_violations; }
+
+    //! Of those, reads moved to the time of the write by a sync.
+    sc_dt::uint64 get_syncs() const { return n_syncs; }
+
+    //! Writes arriving after a read with a later time stamp.
+    sc_dt::uint64 get_stale_reads() const { return n_stale; }
+
+private:
+
+    //! A declared region and the time stamps of its granules.
+    struct region
+    {
+        sc_dt::uint64                  start, bytes, granule;
+        std::vector<sc_core::sc_time>  last_write, last_read;
+    };
+
+    //! The region containing the address, 0 if none.
+    region* find(sc_dt::uint64 addr)
+    {
+        for (size_t i = 0; i < regions.size(); i++)
+        {
+            if (addr - regions[i].start < regions[i].bytes) return &regions[i];
+        }
+        return 0;
+    }
+
+    //! Calls f(region, granule) for each tracked granule of the len bytes.
+    template <class F>
+    void each_granule(sc_dt::uint64 addr, unsigned int len, F f)
+    {
+        sc_dt::uint64 end = addr + (len ? len : 1);
+        while (addr < end)
+        {
+            region* r = find(addr);
+            if (r == 0) { addr++; continue; }
+
+            size_t g = (addr - r->start) / r->granule;
+            f(*r, g);
+            addr = r->start + (g + 1) * r->granule;
+        }
+    }
+
+    //! The declared regions.
+    std::vector<region> regions;
+
+    //! Statistics.
+    sc_dt::uint64 n_violations, n_syncs, n_stale;
+};
+
+#endif
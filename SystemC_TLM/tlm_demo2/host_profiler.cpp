@@ -0,0 +1,351 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/host_profiler.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Host time profiler implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "host_profiler.h"
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! The profiler of the simulation.
+//------------------------------------------------------------------------------
+host_profiler& host_profiler::instance()
+{
+    static host_profiler the_profiler;
+    return the_profiler;
+}
+
+
+host_profiler::host_profiler()
+: active(false), last(0), t_start(0), t_stop(0), kernel(-1),
+  running(0), running_obj(0)
+{
+}
+
+
+sc_dt::uint64 host_profiler::now()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(
+               chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+//------------------------------------------------------------------------------
+//! Clears all data and starts profiling.
+//------------------------------------------------------------------------------
+void host_profiler::start()
+{
+    nodes.clear();
+    processes.clear();
+    kernel      = add_node("[kernel]", 0, -1);
+    running     = 0;
+    running_obj = 0;
+    active      = true;
+    t_start     = last = now();
+}
+
+
+//------------------------------------------------------------------------------
+//! Stops profiling, the time since the last event is kernel time.
+//------------------------------------------------------------------------------
+void host_profiler::stop()
+{
+    if (!active) return;
+    t_stop = now();
+    nodes[kernel].self_ns += t_stop - last;
+    active = false;
+}
+
+
+int host_profiler::add_node(const string& name, const char* key, int parent)
+{
+    node n;
+    n.name    = name;
+    n.key     = key;
+    n.parent  = parent;
+    n.self_ns = 0;
+    n.calls   = 0;
+    nodes.push_back(n);
+
+    int id = int(nodes.size()) - 1;
+    if (parent >= 0) nodes[parent].children.push_back(id);
+    return id;
+}
+
+
+//------------------------------------------------------------------------------
+//! Charges the host time since the last event.
+//
+//! If the current process is the one of the last event, the time is charged
+//! to its innermost frame. Otherwise the kernel ran in between: the time goes
+//! to "[kernel]" and the current process counts one seen activation. An
+//! activation ending before any event is not seen.
+//
+//! @param t  Host time of the event
+//
+//! @return The state of the current process
+//------------------------------------------------------------------------------
+host_profiler::process& host_profiler::charge(sc_dt::uint64 t)
+{
+    sc_process_handle h = sc_get_current_process_handle();
+    const sc_object* obj = h.valid() ? h.get_process_object() : 0;
+
+    if (running && obj == running_obj)
+    {
+        nodes[running->stack.back()].self_ns += t - last;
+        return *running;
+    }
+
+    nodes[kernel].self_ns += t - last;
+
+    map<const sc_object*, process>::iterator it = processes.find(obj);
+    if (it == processes.end())
+    {
+        process p;
+        p.root        = add_node(obj ? h.name() : "[sc_main]", 0, -1);
+        p.seen_activations = 0;
+        p.seen_switches    = 0;
+        p.thread      = obj && h.proc_kind() != SC_METHOD_PROC_;
+        p.stack.push_back(p.root);
+        it = processes.insert(make_pair(obj, p)).first;
+    }
+
+    process& p = it->second;
+    p.seen_activations++;
+    if (p.thread) p.seen_switches++;
+
+    running     = &p;
+    running_obj = obj;
+    return p;
+}
+
+
+//------------------------------------------------------------------------------
+//! Enters the frame "name" in the current process.
+//
+//! @param name  Frame name. Frames are matched by the address of the string,
+//!              so pass a string literal.
+//------------------------------------------------------------------------------
+void host_profiler::enter(const char* name)
+{
+    sc_dt::uint64 t = now();
+    process& p = charge(t);
+
+    int top = p.stack.back();
+    int child = -1;
+    for (size_t i = 0; i < nodes[top].children.size(); i++)
+    {
+        if (nodes[nodes[top].children[i]].key == name)
+        {
+            child = nodes[top].children[i];
+            break;
+        }
+    }
+    if (child < 0) child = add_node(name, name, top);
+
+    nodes[child].calls++;
+    p.stack.push_back(child);
+    last = t;
+}
+
+
+//------------------------------------------------------------------------------
+//! Leaves the innermost frame of the current process.
+//------------------------------------------------------------------------------
+void host_profiler::leave()
+{
+    sc_dt::uint64 t = now();
+    process& p = charge(t);
+
+    if (p.stack.size() > 1) p.stack.pop_back();
+    last = t;
+}
+
+
+//------------------------------------------------------------------------------
+//! Marks the current process as suspended, the following time is kernel time.
+//------------------------------------------------------------------------------
+void host_profiler::suspend()
+{
+    sc_dt::uint64 t = now();
+    charge(t);
+    running     = 0;
+    running_obj = 0;
+    last = t;
+}
+
+
+//------------------------------------------------------------------------------
+//! Marks the current process as resumed, the time up to now is kernel time.
+//------------------------------------------------------------------------------
+void host_profiler::resume()
+{
+    sc_dt::uint64 t = now();
+    charge(t);
+    last = t;
+}
+
+
+void host_profiler::totals(vector<sc_dt::uint64>& total) const
+{
+    total.resize(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) total[i] = nodes[i].self_ns;
+
+    // children are always created after their parents
+    for (size_t i = nodes.size(); i-- > 0; )
+    {
+        if (nodes[i].parent >= 0) total[nodes[i].parent] += total[i];
+    }
+}
+
+
+string host_profiler::path(int n) const
+{
+    string s = nodes[n].name;
+    for (int p = nodes[n].parent; p >= 0; p = nodes[p].parent)
+    {
+        s = nodes[p].name + ";" + s;
+    }
+    return s;
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the flat profile.
+//
+//! The process table lists the host time of each process including its TLM
+//! calls, and the activations and thread switches seen at the instrumented
+//! sites. The frame table lists the self and inclusive time of each frame
+//! name summed over all processes.
+//
+//! @param os  Output stream
+//------------------------------------------------------------------------------
+void host_profiler::write_flat(ostream& os) const
+{
+    vector<sc_dt::uint64> total;
+    totals(total);
+
+    sc_dt::uint64 t_all = (active ? now() : t_stop) - t_start;
+    if (t_all == 0) t_all = 1;
+
+    os << "Host profile, total " << fixed << setprecision(3)
+       << t_all * 1e-6 << " ms" << endl << endl;
+
+    // per process
+    os << setw(40) << left << "process" << right
+       << setw(12) << "ms" << setw(8) << "%"
+       << setw(14) << "seen activ." << setw(14) << "seen switches"
+       << setw(12) << "ns/act" << endl;
+
+    os << setw(40) << left << "[kernel]" << right
+       << setw(12) << total[kernel] * 1e-6
+       << setw(8)  << 100.0 * total[kernel] / t_all << endl;
+
+    for (map<const sc_object*, process>::const_iterator it = processes.begin();
+         it != processes.end(); ++it)
+    {
+        const process& p = it->second;
+        os << setw(40) << left << nodes[p.root].name << right
+           << setw(12) << total[p.root] * 1e-6
+           << setw(8)  << 100.0 * total[p.root] / t_all
+           << setw(14) << p.seen_activations
+           << setw(14) << p.seen_switches
+           << setw(12) << (p.seen_activations ? total[p.root] / p.seen_activations : 0)
+           << endl;
+    }
+    os << endl;
+
+    // per frame name, recursion counted once in the inclusive time
+    struct frame { sc_dt::uint64 self, incl, calls; };
+    map<string, frame> frames;
+
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        if (nodes[i].key == 0) continue; // process roots and kernel
+
+        frame& f = frames[nodes[i].name];
+        f.self  += nodes[i].self_ns;
+        f.calls += nodes[i].calls;
+
+        bool nested = false;
+        for (int p = nodes[i].parent; p >= 0; p = nodes[p].parent)
+        {
+            if (nodes[p].name == nodes[i].name) { nested = true; break; }
+        }
+        if (!nested) f.incl += total[i];
+    }
+
+    vector<pair<sc_dt::uint64, string> > order;
+    for (map<string, frame>::const_iterator it = frames.begin();
+         it != frames.end(); ++it)
+    {
+        order.push_back(make_pair(it->second.self, it->first));
+    }
+    sort(order.rbegin(), order.rend());
+
+    os << setw(40) << left << "frame" << right
+       << setw(12) << "self ms" << setw(8) << "%"
+       << setw(12) << "incl ms" << setw(14) << "calls"
+       << setw(12) << "ns/call" << endl;
+
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        const frame& f = frames[order[i].second];
+        os << setw(40) << left << order[i].second << right
+           << setw(12) << f.self * 1e-6
+           << setw(8)  << 100.0 * f.self / t_all
+           << setw(12) << f.incl * 1e-6
+           << setw(14) << f.calls
+           << setw(12) << (f.calls ? f.incl / f.calls : 0)
+           << endl;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the collapsed stacks for flame graph tools, e.g. flamegraph.pl.
+//
+//! @param os  Output stream
+//------------------------------------------------------------------------------
+void host_profiler::write_collapsed(ostream& os) const
+{
+    for (size_t i = 0; i < nodes.size(); i++)
+    {
+        if (nodes[i].self_ns) os << path(int(i)) << " " << nodes[i].self_ns << "\n";
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the flat profile and the collapsed stacks to the given files.
+//
+//! @param flat_file       File name of the flat profile
+//! @param collapsed_file  File name of the collapsed stacks
+//
+//! @return False if a file could not be written
+//------------------------------------------------------------------------------
+bool host_profiler::write(const char* flat_file, const char* collapsed_file) const
+{
+    ofstream flat(flat_file);
+    ofstream collapsed(collapsed_file);
+    if (!flat || !collapsed) return false;
+
+    write_flat(flat);
+    write_collapsed(collapsed);
+    return flat.good() && collapsed.good();
+}
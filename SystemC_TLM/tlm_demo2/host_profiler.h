@@ -0,0 +1,199 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/host_profiler.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Host time profiler for SystemC processes and TLM callbacks
+ *
+ * The profiler is compiled in with the preprocessor definition HOST_PROFILE.
+ * Without it the macros below expand to nothing, resp. to a plain wait(), and
+ * the models carry no instrumentation cost:
+ *
+ *   PROF_SCOPE("name")   profiles the enclosing block as a frame "name"
+ *   PROF_WAIT(...)       sc_core::wait(...) marking the process suspended
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_host_profiler_h_
+#define _tlm_demo2_host_profiler_h_
+
+#include <systemc>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <map>
+
+
+//------------------------------------------------------------------------------
+//! Host time profiler.
+//
+//! The host time is charged to a stack of frames per SystemC process. The root
+//! frame of a stack is the process itself, frames are pushed and popped by
+//! PROF_SCOPE, e.g. in the b_transport callbacks. Since a TLM call runs in the
+//! process of the initiator, the stack of a processor thread reads
+//! "i_cpu0.program_thread;bus::b_transport;memory::bus_readwrite".
+//
+//! Process switches are detected on each profiler event by comparing the
+//! current process with the last one seen, so they are attributed correctly
+//! even though SystemC threads switch stacks under the host profiler's feet.
+//! The host time between the last event of a process and the first event of
+//! the next one is charged to the "[kernel]" frame. PROF_WAIT narrows this
+//! gap to the time actually spent in the SystemC kernel.
+//
+//! The profiler only sees the instrumented sites, PROF_SCOPE and PROF_WAIT,
+//! SystemC has no hook called at every process switch. The counts per
+//! process are therefore the activations and thread switches observed at
+//! these sites: a process activated without reaching one is not counted,
+//! and its host time goes to "[kernel]".
+//
+//! TLM calls from outside of any process are charged to a "[sc_main]" stack.
+//------------------------------------------------------------------------------
+class host_profiler
+{
+public:
+
+    //! The profiler of the simulation.
+    static host_profiler& instance();
+
+    //! Clears all data and starts profiling, e.g. right before sc_start().
+    void start();
+
+    //! Stops profiling, e.g. right after sc_start().
+    void stop();
+
+    //! True while profiling.
+    bool is_active() const { return active; }
+
+    //! Enters the frame "name" in the current process.
+    void enter(const char* name);
+
+    //! Leaves the innermost frame of the current process.
+    void leave();
+
+    //! Marks the current process as suspended in the kernel.
+    void suspend();
+
+    //! Marks the current process as resumed by the kernel.
+    void resume();
+
+    //! Writes the flat profile, per process and per frame.
+    void write_flat(std::ostream& os) const;
+
+    //! Writes the collapsed stacks, one line per stack with the self time in ns.
+    void write_collapsed(std::ostream& os) const;
+
+    //! Writes the flat profile and the collapsed stacks to the given files.
+    bool write(const char* flat_file, const char* collapsed_file) const;
+
+private:
+
+    //! A frame in the call tree.
+    struct node
+    {
+        std::string       name;     //!< Frame name
+        const char*       key;      //!< Frame key, the PROF_SCOPE string
+        int               parent;   //!< Parent node, -1 for a root
+        sc_dt::uint64     self_ns;  //!< Host time spent in this frame
+        sc_dt::uint64     calls;    //!< Number of times entered
+        std::vector<int>  children; //!< Child nodes
+    };
+
+    //! Profiling state of one SystemC process.
+    struct process
+    {
+        int               root;         //!< Root node of the process
+        std::vector<int>  stack;        //!< Current stack of nodes
+        sc_dt::uint64     seen_activations; //!< Switches in seen at a site
+        sc_dt::uint64     seen_switches;    //!< Of those, thread context switches
+        bool              thread;       //!< SC_THREAD or SC_CTHREAD
+    };
+
+    host_profiler();
+
+    //! Host time in ns.
+    static sc_dt::uint64 now();
+
+    //! Creates a node.
+    int add_node(const std::string& name, const char* key, int parent);
+
+    //! Charges the host time since the last event and returns the current
+    //! process, counting a seen activation if it was switched in.
+    process& charge(sc_dt::uint64 t);
+
+    //! Host time of node n including all its children.
+    void totals(std::vector<sc_dt::uint64>& total) const;
+
+    //! Frame names from the root to node n, separated by ';'.
+    std::string path(int n) const;
+
+    //! True while profiling.
+    bool active;
+
+    //! Host time of the last event.
+    sc_dt::uint64 last;
+
+    //! Host time of start() and stop().
+    sc_dt::uint64 t_start, t_stop;
+
+    //! All frames.
+    std::vector<node> nodes;
+
+    //! Frame of the host time outside of any process.
+    int kernel;
+
+    //! Process states by process object, zero for sc_main.
+    std::map<const sc_core::sc_object*, process> processes;
+
+    //! Process which caused the last event, zero if suspended.
+    process* running;
+
+    //! Process object of ::running.
+    const sc_core::sc_object* running_obj;
+};
+
+
+//------------------------------------------------------------------------------
+//! Profiles the enclosing scope as a frame, see PROF_SCOPE.
+//------------------------------------------------------------------------------
+class host_profile_scope
+{
+public:
+    host_profile_scope(const char* name) : on(host_profiler::instance().is_active())
+    {
+        if (on) host_profiler::instance().enter(name);
+    }
+
+    ~host_profile_scope()
+    {
+        if (on) host_profiler::instance().leave();
+    }
+
+private:
+    bool on;
+};
+
+
+#ifdef HOST_PROFILE
+
+#define PROF_SCOPE(name) host_profile_scope host_profile_scope_(name)
+
+#define PROF_WAIT(...)                                                         \
+    do {                                                                       \
+        host_profiler& prof_ = host_profiler::instance();                     \
+        if (prof_.is_active()) prof_.suspend();                               \
+        sc_core::wait(__VA_ARGS__);                                            \
+        if (prof_.is_active()) prof_.resume();                                \
+    } while (0)
+
+#else
+
+#define PROF_SCOPE(name)
+
+#define PROF_WAIT(...) sc_core::wait(__VA_ARGS__)
+
+#endif
+
+#endif
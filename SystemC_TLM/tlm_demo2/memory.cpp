@@ -11,6 +11,13 @@
  * ****************************************************************************/
 
 #include "memory.h"
+#include "sim_mode.h"
+#include "host_profiler.h"
+#include "sg_extension.h"
+#include "txn_extensions.h"
+#include "speed_monitor.h"
+
+#include <sstream>
 
 using namespace sc_core;
 using namespace std;
@@ -19,16 +26,53 @@ using namespace std;
 //! Class Constructor of the memory module
 //
 //! Registers the blocking call back function "bus_readwrite" with target
-//! data_bus.
+//! data_bus, and the tagged call backs with the sockets "data_bus1" ... of
+//! the further ports, the tag is the port number.
 //! The memory array is first initialized with random numbers. A test struct
 //! data is then loaded  to the memory array from the starting address 0x00.
+//
+//! @param name     SystemC module name
+//! @param logging  Print every transaction and memory update to the console.
+//!                 Disable it for throughput measurements.
+//! @param n_ports  Number of target ports, at least 1
 //------------------------------------------------------------------------------
-memory::memory(sc_module_name  name) :
-sc_module (name), data_bus("data_bus")
+memory::memory(sc_module_name  name, bool logging, unsigned int n_ports) :
+sc_module (name), data_bus("data_bus"), dmi(false), mem(local_mem),
+hdr(&local_hdr), logging(logging)
 {
+    local_hdr.generation = 0;
+    
     //! Register callback for incoming bus_readwrite interface method call.
     data_bus.register_b_transport(this, &memory::bus_readwrite);
     
+    //! Register callback for incoming debug transport calls.
+    data_bus.register_transport_dbg(this, &memory::debug_transport);
+    
+    //! Register callback for incoming DMI requests.
+    data_bus.register_get_direct_mem_ptr(this, &memory::get_direct_mem_ptr);
+    
+    //! Port 0 is data_bus, the further ports get a socket and timing of their own.
+    if (n_ports < 1) n_ports = 1;
+    ports.resize(n_ports);
+    for (unsigned int i = 0; i < n_ports; i++)
+    {
+        memory_port& p = ports[i];
+        p.socket     = 0;
+        p.timing     = &timing;
+        p.n_accesses = 0;
+        p.n_remote   = 0;
+        if (i == 0) continue;
+        
+        ostringstream socket_name;
+        socket_name << "data_bus" << i;
+        p.socket = new tlm_utils::simple_target_socket_tagged<memory>(socket_name.str().c_str());
+        p.timing = new memory_timing();
+        
+        p.socket->register_b_transport(this, &memory::port_readwrite, i);
+        p.socket->register_transport_dbg(this, &memory::port_debug, i);
+        p.socket->register_get_direct_mem_ptr(this, &memory::port_dmi, i);
+    }
+    
     //! Initialize memory with random data.
     for (int i = 0; i < MEM_SIZE; i++)  mem[i] = rand() % 0xFF;
     
@@ -48,13 +92,80 @@ sc_module (name), data_bus("data_bus")
     memcpy(&mem[0x00], &test_data, sizeof(test_data));
     
     // Print memory contents for debug purpose
-    print_memory(3);
+    if (logging) print_memory(3);
 }
 
 
 
 //------------------------------------------------------------------------------
-//! Blocking transport callback function  processes the transaction it received.
+//! Class Destructor, unmaps the shared memory if the storage was moved there.
+//------------------------------------------------------------------------------
+memory::~memory()
+{
+    if (hdr != &local_hdr) memory_shm_detach(hdr);
+    
+    for (size_t i = 1; i < ports.size(); i++)
+    {
+        delete ports[i].socket;
+        delete ports[i].timing;
+    }
+}
+
+
+
+//------------------------------------------------------------------------------
+//! Target socket of a port, to bind an initiator or a router to it.
+//
+//! @param i  The port number, 0 is data_bus
+//------------------------------------------------------------------------------
+tlm::tlm_target_socket<32>& memory::port(unsigned int i)
+{
+    if (i == 0) return data_bus;
+    return *ports.at(i).socket;
+}
+
+
+
+//------------------------------------------------------------------------------
+//! Moves the storage into a shared memory, so that other processes can map
+//! the memory contents read-only, see memory_shm.h.
+//
+//! The current contents are copied, the object is not removed at the end of
+//! the simulation to allow a post-mortem inspection. Call it before the
+//! simulation starts.
+//
+//! @param shm_name  Shared memory object, e.g. "/vp_memory", or file name
+//
+//! @return False if the shared memory could not be created
+//------------------------------------------------------------------------------
+bool memory::map_shared(const char* shm_name)
+{
+    if (hdr != &local_hdr)
+    {
+        SC_REPORT_ERROR("memory", "storage is already shared");
+        return false;
+    }
+    
+    memory_shm_header* shm = memory_shm_create(shm_name, name(), MEM_SIZE);
+    if (shm == 0)
+    {
+        SC_REPORT_ERROR("memory", (string("can not create ") + shm_name).c_str());
+        return false;
+    }
+    
+    memcpy(memory_shm_data(shm), local_mem, MEM_SIZE);
+    shm->generation = local_hdr.generation & ~sc_dt::uint64(1);
+    
+    mem = memory_shm_data(shm);
+    hdr = shm;
+    return true;
+}
+
+
+
+//------------------------------------------------------------------------------
+//! Blocking transport callback function of data_bus, the transaction is
+//! processed as one of port 0.
 //
 //! @param payload  The generic TLM payload
 //! @param delay    How far the initiator is beyond baseline SystemC time.
@@ -62,6 +173,35 @@ sc_module (name), data_bus("data_bus")
 void memory::bus_readwrite( tlm::tlm_generic_payload& payload,
                            sc_time& delay )
 {
+    port_readwrite(0, payload, delay);
+}
+
+//------------------------------------------------------------------------------
+//! Blocking transport callback function  processes the transaction it received.
+//
+//! A payload with an sg_extension is a scatter-gather transaction, all its
+//! segments are executed in this call, see scatter_gather().
+//
+//! @param id       The port number, the tag of the socket
+//! @param payload  The generic TLM payload
+//! @param delay    How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void memory::port_readwrite( int id, tlm::tlm_generic_payload& payload,
+                             sc_time& delay )
+{
+    PROF_SCOPE("memory::bus_readwrite");
+    
+    SPEED_COUNT(transaction());
+    
+    memory_port& p = ports[id];
+    
+    sg_extension* sg = 0;
+    payload.get_extension(sg);
+    if (sg)
+    {
+        scatter_gather(p, payload, *sg, delay);
+        return;
+    }
     
     tlm::tlm_command cmd         = payload.get_command();
     sc_dt::uint64    addr        = payload.get_address();
@@ -71,35 +211,224 @@ void memory::bus_readwrite( tlm::tlm_generic_payload& payload,
     unsigned int     width       = payload.get_streaming_width();
     
     // logging
-    cout << "(Memory)    @ " << sc_time_stamp() << ", Logging "  << endl;
-    cout << "    Command : " << (cmd ? "WRITE" : "READ") <<endl;
-    cout << "    Address : 0x" << setw(8) << setfill('0') << hex << uppercase;
-    cout << addr << endl;
-    if( cmd == tlm::TLM_WRITE_COMMAND )
+    if (logging)
     {
-        cout << "    Data    : 0x" << setw(2) << setfill('0');
-        cout << hex << uppercase << *((uint32_t*) data_ptr) << endl;
+        cout << "(Memory)    @ " << sc_time_stamp() << ", Logging "  << endl;
+        if (ports.size() > 1) cout << "    Port    : " << dec << id << endl;
+        cout << "    Command : " << (cmd ? "WRITE" : "READ") <<endl;
+        cout << "    Address : 0x" << setw(8) << setfill('0') << hex << uppercase;
+        cout << addr << endl;
+        if( cmd == tlm::TLM_WRITE_COMMAND )
+        {
+            cout << "    Data    : 0x" << setw(2) << setfill('0');
+            cout << hex << uppercase << *((uint32_t*) data_ptr) << endl;
+        }
+        if( byte_en_ptr != 0 )
+        {
+            cout << "    Byte_en : 0x" << setw(8) << setfill('0');
+            cout << hex << uppercase << *((uint32_t*) byte_en_ptr) << endl;
+        }
+        txn_id*        id        = payload.get_extension<txn_id>();
+        txn_initiator* initiator = payload.get_extension<txn_initiator>();
+        if( id != 0 && initiator != 0 )
+        {
+            cout << "    Txn     : " << dec << id->id << " from ";
+            cout << initiator->initiator->name() << endl;
+        }
+        cout << endl;
     }
-    if( byte_en_ptr != 0 )
+    // end of logging
+
+    bool timed = sim_mode::instance().is_timed();
+    if (!check_affinity(p, addr, delay, timed))
     {
-        cout << "    Byte_en : 0x" << setw(8) << setfill('0');
-        cout << hex << uppercase << *((uint32_t*) byte_en_ptr) << endl;
+        payload.set_response_status( tlm::TLM_ADDRESS_ERROR_RESPONSE );
+        return;
     }
-    cout << endl;
-    // end of logging
+    
+    if (timed && causality.active()) order_access(cmd, addr, length, delay);
+    
+    tlm::tlm_response_status status =
+        access(cmd, addr, data_ptr, length, byte_en_ptr, width);
+    
+    payload.set_response_status( status );
+    if (status != tlm::TLM_OK_RESPONSE) return;
+    
+    payload.set_dmi_allowed(timed && dmi && p.affinity.local_banks == 0 && !causality_blocks_dmi());
+    
+    if (logging && cmd == tlm::TLM_WRITE_COMMAND) print_memory(3);
+    
+    // add delay as appropriate, functional mode runs without timing
+    if (timed) p.timing->annotate(cmd, addr, delay);
+}
+
+//------------------------------------------------------------------------------
+//! True if regions are declared to ::causality in TIMED mode. An initiator
+//! accessing the memory over DMI would bypass the tracker, so no port grants
+//! DMI, not even as a hint in the response of a transaction.
+//------------------------------------------------------------------------------
+bool memory::causality_blocks_dmi() const
+{
+    return causality.active() && sim_mode::instance().is_timed();
+}
+
+//------------------------------------------------------------------------------
+//! Checks an access to a shared region against the accesses of the other
+//! initiators, see causality_tracker.h.
+//
+//! With the SYNC policy a read from the past of a write is moved to the time
+//! of the write: the calling thread waits until then and continues with a
+//! zero delay, so the initiator is synchronized as by its quantum keeper.
+//! b_transport is called from the thread of the initiator, which is allowed
+//! to wait. Initiators running in an SC_METHOD, e.g. tlm_demo4, can only use
+//! the FLAG policy, a read to sync from a method is an error.
+//
+//! @param cmd     The TLM command
+//! @param addr    The address of the access
+//! @param length  The number of bytes, all granules spanned are checked
+//! @param delay   How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void memory::order_access( tlm::tlm_command cmd, sc_dt::uint64 addr,
+                           unsigned int length, sc_time& delay )
+{
+    sc_dt::uint64 offset = addr % MEM_SIZE;
+    sc_time       t      = sc_time_stamp() + delay;
+    
+    if (cmd == tlm::TLM_WRITE_COMMAND)
+    {
+        causality.write(offset, length, t);
+        return;
+    }
+    if (cmd != tlm::TLM_READ_COMMAND) return;
+    
+    sc_time behind = causality.read(offset, length, t);
+    if (behind == SC_ZERO_TIME) return;
+    
+    if (logging)
+    {
+        cout << "(Memory)    @ " << sc_time_stamp() << ", read of 0x" << hex << offset;
+        cout << " at " << t << " precedes a write by " << behind << endl;
+    }
+    
+    if (causality.policy == causality_tracker::SYNC)
+    {
+        sc_curr_proc_kind kind = sc_get_current_process_handle().proc_kind();
+        if (kind != SC_THREAD_PROC_ && kind != SC_CTHREAD_PROC_)
+        {
+            SC_REPORT_ERROR("memory", "the SYNC causality policy needs an initiator thread");
+            return;
+        }
+        PROF_WAIT(delay + behind);
+        delay = SC_ZERO_TIME;
+    }
+}
 
+//------------------------------------------------------------------------------
+//! Counts an access of a port and applies its bank affinity.
+//
+//! @param p      The port
+//! @param addr   The address of the access
+//! @param delay  The annotated delay, a remote access adds the remote delay
+//! @param timed  Annotate the remote delay
+//
+//! @return False if the access must be rejected
+//------------------------------------------------------------------------------
+bool memory::check_affinity( memory_port& p, sc_dt::uint64 addr,
+                             sc_time& delay, bool timed )
+{
+    p.n_accesses++;
+    if (p.affinity.is_local(addr)) return true;
+    
+    p.n_remote++;
+    if (p.affinity.exclusive) return false;
     
+    if (timed) delay += p.affinity.remote_delay;
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//! Executes all segments of a scatter-gather transaction.
+//
+//! Each segment is executed and timed as a transaction of its own, the delays
+//! add up in the one delay argument.
+//
+//! @param p        The port receiving the transaction
+//! @param payload  The carrier payload
+//! @param sg       Its scatter-gather extension
+//! @param delay    How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void memory::scatter_gather( memory_port& p, tlm::tlm_generic_payload& payload,
+                             sg_extension& sg, sc_time& delay )
+{
+    bool timed = sim_mode::instance().is_timed();
     
+    if (logging)
+    {
+        cout << "(Memory)    @ " << sc_time_stamp() << ", Logging "  << endl;
+        cout << "    Command : " << (sg.command ? "WRITE" : "READ") << endl;
+        cout << "    Segments: " << dec << sg.segments.size() << endl;
+        cout << endl;
+    }
+    
+    for (size_t i = 0; i < sg.segments.size(); i++)
+    {
+        sg_segment& s = sg.segments[i];
+        if (!check_affinity(p, s.addr, delay, timed))
+        {
+            s.status = tlm::TLM_ADDRESS_ERROR_RESPONSE;
+            continue;
+        }
+        if (timed && causality.active()) order_access(sg.command, s.addr, s.length, delay);
+        s.status = access(sg.command, s.addr, s.data, s.length, s.byte_en, s.length);
+        
+        if (timed && s.status == tlm::TLM_OK_RESPONSE)
+        {
+            p.timing->annotate(sg.command, s.addr, delay);
+        }
+    }
+    
+    if (logging && sg.command == tlm::TLM_WRITE_COMMAND) print_memory(3);
+    
+    sg.executed = true;
+    sg_set_response(payload, sg);
+    if (payload.is_response_ok())
+        payload.set_dmi_allowed(timed && dmi && p.affinity.local_banks == 0 && !causality_blocks_dmi());
+}
+
+//------------------------------------------------------------------------------
+//! Reads or writes the memory array for one transaction or segment.
+//
+//! @param cmd          The TLM command
+//! @param addr         The address
+//! @param data_ptr     The data buffer
+//! @param length       The data length, at most 4 bytes
+//! @param byte_en_ptr  The 32-bit byte enable mask, or 0
+//! @param width        The streaming width
+//
+//! @return The response status
+//------------------------------------------------------------------------------
+tlm::tlm_response_status memory::access( tlm::tlm_command  cmd,
+                                         sc_dt::uint64     addr,
+                                         unsigned char*    data_ptr,
+                                         unsigned int      length,
+                                         unsigned char*    byte_en_ptr,
+                                         unsigned int      width )
+{
     // check for unsupported features
     if (length > 4 || width < length)
     {
-        payload.set_response_status( tlm::TLM_GENERIC_ERROR_RESPONSE );
-        return;
+        return tlm::TLM_GENERIC_ERROR_RESPONSE;
     }
     
     // memory address offset
     uint8_t addr_offset = addr & 0xFF;
     
+    // accesses must not run past the end of the memory array
+    if (addr_offset + length > MEM_SIZE)
+    {
+        return tlm::TLM_ADDRESS_ERROR_RESPONSE;
+    }
+    
     // implement read and write commands
     switch( cmd )
     {
@@ -118,13 +447,16 @@ void memory::bus_readwrite( tlm::tlm_generic_payload& payload,
                        &mem[addr_offset],length);
                 mem_temp &= ~ (*((uint32_t *) byte_en_ptr));
                 mem_temp |=  (*((uint32_t *) data_ptr));
+                write_begin();
                 memcpy( &mem[addr_offset],
                        reinterpret_cast<uint8_t*>(&mem_temp), length);
+                write_end();
             }else{ // byte enable ptr not used.
+                write_begin();
                 memcpy( &mem[addr_offset],
                        reinterpret_cast<uint8_t*>(data_ptr), length);
+                write_end();
             }
-            print_memory(3); // print contents of memory
             break;
         case tlm::TLM_IGNORE_COMMAND:
             break;
@@ -132,24 +464,116 @@ void memory::bus_readwrite( tlm::tlm_generic_payload& payload,
             break;
     }
     
-    // add delay as appropriate
-    switch( cmd )
+    // successful completion
+    return tlm::TLM_OK_RESPONSE;
+}
+
+//------------------------------------------------------------------------------
+//! DMI request callback function of data_bus, see port_dmi().
+//
+//! @param payload   The generic TLM payload, its address and command
+//! @param dmi_data  The granted region
+//
+//! @return  True if DMI is granted
+//------------------------------------------------------------------------------
+bool memory::get_direct_mem_ptr( tlm::tlm_generic_payload& payload,
+                                 tlm::tlm_dmi& dmi_data )
+{
+    return port_dmi(0, payload, dmi_data);
+}
+
+//------------------------------------------------------------------------------
+//! DMI request callback function, grants the array if ::dmi is set.
+//
+//! The memory array appears at every multiple of its size, the region
+//! containing the requested address is granted. The latencies are the ones
+//! of a word access without contention, see latency() of the timing policy,
+//! the state of a bank or DRAM timing is not tracked for DMI accesses. A
+//! shared storage is granted read-only, since DMI writes would bypass the
+//! generation counter of memory_shm.h. A port with local banks gets no DMI,
+//! the region would bypass its affinity, and neither does any port while
+//! regions are declared to ::causality, the region would bypass the tracker.
+//! DMI is granted in TIMED mode only. A region granted in FUNCTIONAL mode
+//! would have no latencies and keep them after the switch to TIMED mode.
+//
+//! @param id        The port number, the tag of the socket
+//! @param payload   The generic TLM payload, its address and command
+//! @param dmi_data  The granted region
+//
+//! @return  True if DMI is granted
+//------------------------------------------------------------------------------
+bool memory::port_dmi( int id, tlm::tlm_generic_payload& payload,
+                       tlm::tlm_dmi& dmi_data )
+{
+    memory_port& p = ports[id];
+    if (!dmi || p.affinity.local_banks != 0) return false;
+    if (!sim_mode::instance().is_timed() || causality_blocks_dmi()) return false;
+    
+    sc_dt::uint64 start = payload.get_address() & ~sc_dt::uint64(MEM_SIZE - 1);
+    
+    dmi_data.set_dmi_ptr(mem);
+    dmi_data.set_start_address(start);
+    dmi_data.set_end_address(start + MEM_SIZE - 1);
+    dmi_data.set_read_latency(p.timing->latency(tlm::TLM_READ_COMMAND,  start));
+    dmi_data.set_write_latency(p.timing->latency(tlm::TLM_WRITE_COMMAND, start));
+    
+    if (hdr != &local_hdr)
+        dmi_data.allow_read();
+    else
+        dmi_data.allow_read_write();
+    
+    return true;
+}
+
+//------------------------------------------------------------------------------
+//! Debug transport callback function, reads or writes the memory without any
+//! timing, logging or length restriction.
+//
+//! As for bus_readwrite, the address is taken modulo the memory size. The
+//! transfer ends at the end of the array, it does not wrap around.
+//
+//! @param payload  The generic TLM payload, byte enables are ignored
+//
+//! @return  The number of bytes transferred
+//------------------------------------------------------------------------------
+unsigned int memory::debug_transport( tlm::tlm_generic_payload& payload )
+{
+    tlm::tlm_command cmd      = payload.get_command();
+    unsigned char*   data_ptr = payload.get_data_ptr();
+    unsigned int     length   = payload.get_data_length();
+    
+    if (cmd != tlm::TLM_READ_COMMAND && cmd != tlm::TLM_WRITE_COMMAND) return 0;
+    
+    unsigned int offset = payload.get_address() % MEM_SIZE;
+    unsigned int done   = MEM_SIZE - offset;
+    if (done > length) done = length;
+    
+    if (cmd == tlm::TLM_READ_COMMAND)
     {
-        case tlm::TLM_READ_COMMAND:
-            // Represent the delay to access one byte data for read
-            delay += sc_time( 5, SC_NS );
-            break;
-        case tlm::TLM_WRITE_COMMAND:
-            // Represent the delay to access one byte data for write
-            delay += sc_time( 5, SC_NS );
-            break;
-        case tlm::TLM_IGNORE_COMMAND:
-            delay = SC_ZERO_TIME;
-            break;
+        memcpy(data_ptr, &mem[offset], done);
+    }
+    else
+    {
+        write_begin();
+        memcpy(&mem[offset], data_ptr, done);
+        write_end();
     }
     
-    // successful completion
-    payload.set_response_status( tlm::TLM_OK_RESPONSE );
+    return done;
+}
+
+//------------------------------------------------------------------------------
+//! Debug transport callback function of a port, all ports see the same
+//! storage, see debug_transport().
+//
+//! @param id       The port number, the tag of the socket
+//! @param payload  The generic TLM payload
+//
+//! @return  The number of bytes transferred
+//------------------------------------------------------------------------------
+unsigned int memory::port_debug( int id, tlm::tlm_generic_payload& payload )
+{
+    return debug_transport(payload);
 }
 
 // -----------------------------------------------------------------------------
@@ -17,37 +17,198 @@
 // #define SC_INCLUDE_DYNAMIC_PROCESSES
 
 #include <iomanip>
+#include <vector>
 #include "systemc"
 #include "tlm.h"
 #include "tlm_utils/simple_target_socket.h"
+#include "memory_timing.h"
+#include "memory_shm.h"
+#include "causality_tracker.h"
 
+class sg_extension;
+
+
+//------------------------------------------------------------------------------
+//! Bank affinity of a memory port.
+//
+//! The address space is interleaved over n_banks banks with the given
+//! granularity. A port reaches the banks set in local_banks directly, an
+//! access to another bank pays remote_delay on top of the timing of the port,
+//! or is rejected with an address error if the port is exclusive. Without
+//! local banks, the default, every bank is local.
+//------------------------------------------------------------------------------
+struct port_affinity
+{
+    uint32_t          local_banks;   //!< bit b set: bank b is local, 0: all banks
+    unsigned int      n_banks;       //!< number of banks, at most 32
+    sc_dt::uint64     interleave;    //!< interleaving granularity in bytes
+    sc_core::sc_time  remote_delay;  //!< added to an access to a remote bank
+    bool              exclusive;     //!< rejects accesses to remote banks
+    
+    //! Default affinity, four banks of a cache line, all of them local
+    port_affinity()
+    : local_banks(0), n_banks(4), interleave(64),
+      remote_delay(sc_core::SC_ZERO_TIME), exclusive(false) {}
+    
+    //! True if the bank of the address is local to the port.
+    bool is_local(sc_dt::uint64 addr) const
+    {
+        if (local_banks == 0) return true;
+        unsigned int bank = (addr / (interleave ? interleave : 1)) % (n_banks ? n_banks : 1);
+        return (local_banks >> bank) & 1;
+    }
+};
 
 
 //------------------------------------------------------------------------------
 //! SystemC-TLM Memory module definition.
+//
+//! The memory has one or more target ports onto the same storage. Port 0 is
+//! ::data_bus with ::timing, further ports are created by the constructor and
+//! reached through port(). Every port has its own timing policy, bank
+//! affinity and statistics, so several initiators can be bound directly or
+//! through a router without serializing all traffic on one socket. A banked
+//! or DRAM timing policy keeps its bank state per port, i.e. the ports model
+//! independent channels. Besides the storage the ports share ::causality,
+//! which records the accesses of all ports to the declared regions, and the
+//! header of a shared storage, whose generation counter every write through
+//! any port advances, see memory_shm.h.
 //------------------------------------------------------------------------------
 class memory: sc_core::sc_module
 {
 public:
     
     //! Class constructor.
-    memory(sc_core::sc_module_name  name);
+    memory(sc_core::sc_module_name  name, bool logging = true,
+           unsigned int n_ports = 1);
+    
+    //! Class destructor, unmaps the shared memory.
+    ~memory();
     
     //! TLM-2 socket, defaults to 32-bits wide, base protocol.
     tlm_utils::simple_target_socket<memory> data_bus;
     
+    //! Timing policy, selected at compile time in memory_timing.h.
+    memory_timing timing;
+    
+    //! Number of target ports.
+    unsigned int get_ports() const { return ports.size(); }
+    
+    //! Target socket of port i, ::data_bus for port 0.
+    tlm::tlm_target_socket<32>& port(unsigned int i);
+    
+    //! Timing policy of port i, ::timing for port 0.
+    memory_timing& port_timing(unsigned int i) { return *ports.at(i).timing; }
+    
+    //! Bank affinity of port i.
+    port_affinity& affinity(unsigned int i) { return ports.at(i).affinity; }
+    
+    //! Number of transactions or segments received on port i.
+    sc_dt::uint64 get_accesses(unsigned int i) const { return ports.at(i).n_accesses; }
+    
+    //! Number of those to a remote bank of port i.
+    sc_dt::uint64 get_remote_accesses(unsigned int i) const { return ports.at(i).n_remote; }
+    
+    //! Moves the storage into a shared memory object or file, see memory_shm.h.
+    bool map_shared(const char* shm_name);
+    
+    //! Grants direct memory access, disabled by default.
+    bool dmi;
+    
+    //! Order of accesses to the shared regions, declared with offsets into
+    //! the memory array, see causality_tracker.h. Tracked in TIMED mode, DMI
+    //! is refused then.
+    causality_tracker causality;
+    
 private:
     
+    //! State of one target port.
+    struct memory_port
+    {
+        //! Tagged socket of the port, 0 for port 0.
+        tlm_utils::simple_target_socket_tagged<memory>* socket;
+        
+        //! Timing policy, ::timing for port 0.
+        memory_timing* timing;
+        
+        //! Bank affinity.
+        port_affinity affinity;
+        
+        //! Statistics.
+        sc_dt::uint64 n_accesses, n_remote;
+    };
+    
+    //! The target ports.
+    std::vector<memory_port> ports;
+    
     //! Memory size 256 bytes.
     static const int MEM_SIZE = 256 ;
     
-    //! Byte array models memory storages.
-    uint8_t mem[MEM_SIZE];
+    //! Byte array models memory storages, ::local_mem or the shared memory.
+    uint8_t* mem;
+    
+    //! Header with the write generation, ::local_hdr or the shared memory.
+    memory_shm_header* hdr;
+    
+    //! Storage unless mapped to a shared memory.
+    uint8_t local_mem[MEM_SIZE];
+    
+    //! Header unless mapped to a shared memory.
+    memory_shm_header local_hdr;
+    
+    //! Enables the transaction log and memory dumps on the console.
+    bool logging;
+    
+    //! Marks the start and the end of a write for readers of a shared
+    //! storage, a local storage has no readers.
+    void write_begin() { if (hdr != &local_hdr) memory_shm_write_begin(hdr); }
+    void write_end()   { if (hdr != &local_hdr) memory_shm_write_end(hdr); }
 
 
     //! Blocking transport routine the target socket.
     void bus_readwrite(tlm::tlm_generic_payload& payload,
                        sc_core::sc_time& delay);
+    
+    //! Blocking transport routine of a port.
+    void port_readwrite(int id, tlm::tlm_generic_payload& payload,
+                        sc_core::sc_time& delay);
+    
+    //! Executes all segments of a scatter-gather transaction.
+    void scatter_gather(memory_port& p, tlm::tlm_generic_payload& payload,
+                        sg_extension& sg, sc_core::sc_time& delay);
+    
+    //! True if the causality tracker forbids DMI, a DMI access would bypass it.
+    bool causality_blocks_dmi() const;
+    
+    //! Checks an access against the shared regions, syncs a read if needed.
+    void order_access(tlm::tlm_command cmd, sc_dt::uint64 addr,
+                      unsigned int length, sc_core::sc_time& delay);
+    
+    //! Applies the bank affinity of the port to one access.
+    bool check_affinity(memory_port& p, sc_dt::uint64 addr,
+                        sc_core::sc_time& delay, bool timed);
+    
+    //! Reads or writes the memory array, returns the response status.
+    tlm::tlm_response_status access(tlm::tlm_command  cmd,
+                                    sc_dt::uint64     addr,
+                                    unsigned char*    data_ptr,
+                                    unsigned int      length,
+                                    unsigned char*    byte_en_ptr,
+                                    unsigned int      width);
+    
+    //! DMI request routine the target socket.
+    bool get_direct_mem_ptr(tlm::tlm_generic_payload& payload,
+                            tlm::tlm_dmi& dmi_data);
+    
+    //! DMI request routine of a port.
+    bool port_dmi(int id, tlm::tlm_generic_payload& payload,
+                  tlm::tlm_dmi& dmi_data);
+    
+    //! Debug transport routine the target socket.
+    unsigned int debug_transport(tlm::tlm_generic_payload& payload);
+    
+    //! Debug transport routine of a port.
+    unsigned int port_debug(int id, tlm::tlm_generic_payload& payload);
    
     //! Prints first n bytes data in the memory for the debug purpose.
     void print_memory(int n);
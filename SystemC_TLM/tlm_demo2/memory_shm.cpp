@@ -0,0 +1,158 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/memory_shm.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Shared memory of the memory module storage, implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "memory_shm.h"
+
+#include <string>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+//! Path of the shared memory object or file.
+//
+//! A name with a single leading '/', e.g. "/vp_memory", is a POSIX shared
+//! memory object. It is opened in /dev/shm as shm_open() does on Linux, which
+//! saves the link dependency to librt. Other names are plain files.
+//------------------------------------------------------------------------------
+static string memory_shm_path(const char* name)
+{
+    if (name[0] == '/' && strchr(name + 1, '/') == 0)
+    {
+        return string("/dev/shm") + name;
+    }
+    return name;
+}
+
+
+//------------------------------------------------------------------------------
+//! Creates the shared memory and maps it read-write.
+//
+//! An existing object of the same name is resized and overwritten.
+//
+//! @param name   Shared memory object, e.g. "/vp_memory", or file name
+//! @param model  SystemC name of the memory module
+//! @param size   Size of the data in bytes
+//
+//! @return The header, zero on failure
+//------------------------------------------------------------------------------
+memory_shm_header* memory_shm_create(const char* name, const char* model,
+                                     uint64_t size)
+{
+    string path  = memory_shm_path(name);
+    size_t total = MEMORY_SHM_HEADER + size;
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) return 0;
+
+    if (ftruncate(fd, total) != 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    void* p = mmap(0, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return 0;
+
+    memory_shm_header* hdr = static_cast<memory_shm_header*>(p);
+    memset(hdr, 0, sizeof(memory_shm_header));
+    memcpy(hdr->magic, MEMORY_SHM_MAGIC, sizeof(hdr->magic));
+    hdr->version     = MEMORY_SHM_VERSION;
+    hdr->header_size = MEMORY_SHM_HEADER;
+    hdr->size        = size;
+    strncpy(hdr->model, model, sizeof(hdr->model) - 1);
+
+    return hdr;
+}
+
+
+//------------------------------------------------------------------------------
+//! Maps an existing shared memory read-only.
+//
+//! @param name   Shared memory object, e.g. "/vp_memory", or file name
+//
+//! @return The header, zero if it does not exist or has another layout
+//------------------------------------------------------------------------------
+const memory_shm_header* memory_shm_attach(const char* name)
+{
+    string path = memory_shm_path(name);
+
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || size_t(st.st_size) < MEMORY_SHM_HEADER)
+    {
+        if (fd >= 0) close(fd);
+        return 0;
+    }
+
+    void* p = mmap(0, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) return 0;
+
+    const memory_shm_header* hdr = static_cast<const memory_shm_header*>(p);
+    if (memcmp(hdr->magic, MEMORY_SHM_MAGIC, sizeof(hdr->magic)) != 0 ||
+        hdr->version != MEMORY_SHM_VERSION ||
+        hdr->header_size + hdr->size > uint64_t(st.st_size))
+    {
+        munmap(p, st.st_size);
+        return 0;
+    }
+
+    return hdr;
+}
+
+
+//------------------------------------------------------------------------------
+//! Unmaps a shared memory mapped by memory_shm_create() or memory_shm_attach().
+//------------------------------------------------------------------------------
+void memory_shm_detach(const memory_shm_header* hdr)
+{
+    if (hdr == 0) return;
+    munmap(const_cast<memory_shm_header*>(hdr), hdr->header_size + hdr->size);
+}
+
+
+//------------------------------------------------------------------------------
+//! Copies a consistent snapshot of the data.
+//
+//! The copy is repeated until no write of the simulation overlapped with it.
+//
+//! @param hdr     The header
+//! @param offset  Offset of the first byte to copy
+//! @param buf     Destination buffer
+//! @param len     Number of bytes to copy, clipped to the data size
+//
+//! @return The generation of the snapshot
+//------------------------------------------------------------------------------
+uint64_t memory_shm_read(const memory_shm_header* hdr, uint64_t offset,
+                         uint8_t* buf, uint64_t len)
+{
+    if (offset >= hdr->size) return memory_shm_generation(hdr);
+    if (len > hdr->size - offset) len = hdr->size - offset;
+
+    while (true)
+    {
+        uint64_t gen = memory_shm_generation(hdr);
+        if (gen & 1) continue; // write in progress
+
+        memcpy(buf, memory_shm_data(hdr) + offset, len);
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (memory_shm_generation(hdr) == gen) return gen;
+    }
+}
@@ -0,0 +1,101 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/memory_shm.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Shared memory layout of the memory module storage
+ *
+ * The memory module can keep its storage in a named POSIX shared memory
+ * object or in a memory mapped file (see memory::map_shared). External tools
+ * map the same pages read-only with memory_shm_attach() and read the memory
+ * contents without any copy or help of the simulation.
+ *
+ * The header does not depend on SystemC, so tools can include it alone.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_memory_shm_h_
+#define _tlm_demo2_memory_shm_h_
+
+#include <stdint.h>
+
+
+//! Magic number at the start of the mapping.
+#define MEMORY_SHM_MAGIC    "VPMEMSHM"
+
+//! Version of the layout.
+#define MEMORY_SHM_VERSION  1
+
+//! Size of the header, the data starts page aligned behind it.
+#define MEMORY_SHM_HEADER   4096
+
+
+//------------------------------------------------------------------------------
+//! Header at the start of the shared memory.
+//
+//! The generation counter is incremented before and after every write of the
+//! simulation, so it is odd while a write is in progress. A reader copying
+//! the data gets a consistent snapshot if the generation is even and did not
+//! change during the copy, see memory_shm_read().
+//------------------------------------------------------------------------------
+struct memory_shm_header
+{
+    char      magic[8];      //!< MEMORY_SHM_MAGIC, not null terminated
+    uint32_t  version;       //!< MEMORY_SHM_VERSION
+    uint32_t  header_size;   //!< Offset of the data from the start
+    uint64_t  size;          //!< Size of the data in bytes
+    uint64_t  generation;    //!< Write counter, odd during a write
+    char      model[64];     //!< SystemC name of the memory module
+};
+
+
+//! Start of the data behind the header.
+inline uint8_t* memory_shm_data(memory_shm_header* hdr)
+{
+    return reinterpret_cast<uint8_t*>(hdr) + hdr->header_size;
+}
+
+//! Start of the data behind the header, for readers.
+inline const uint8_t* memory_shm_data(const memory_shm_header* hdr)
+{
+    return reinterpret_cast<const uint8_t*>(hdr) + hdr->header_size;
+}
+
+//! Marks the start of a write, the generation becomes odd.
+inline void memory_shm_write_begin(memory_shm_header* hdr)
+{
+    __atomic_store_n(&hdr->generation, hdr->generation + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+//! Marks the end of a write, the generation becomes even.
+inline void memory_shm_write_end(memory_shm_header* hdr)
+{
+    __atomic_store_n(&hdr->generation, hdr->generation + 1, __ATOMIC_RELEASE);
+}
+
+//! Generation of the data, for readers.
+inline uint64_t memory_shm_generation(const memory_shm_header* hdr)
+{
+    return __atomic_load_n(&hdr->generation, __ATOMIC_ACQUIRE);
+}
+
+
+//! Creates the shared memory for size bytes of data and maps it read-write.
+memory_shm_header* memory_shm_create(const char* name, const char* model,
+                                     uint64_t size);
+
+//! Maps an existing shared memory read-only.
+const memory_shm_header* memory_shm_attach(const char* name);
+
+//! Unmaps a shared memory.
+void memory_shm_detach(const memory_shm_header* hdr);
+
+//! Copies a consistent snapshot of the data, returns its generation.
+uint64_t memory_shm_read(const memory_shm_header* hdr, uint64_t offset,
+                         uint8_t* buf, uint64_t len);
+
+#endif
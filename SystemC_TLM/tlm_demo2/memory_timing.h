@@ -0,0 +1,363 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/memory_timing.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Timing policies of the memory module
+ *
+ * The memory annotates the access delay through a timing policy. The policy
+ * is selected at compile time with a preprocessor definition, so that a
+ * platform only pays for the timing model it uses:
+ *
+ *   (none)                  flat_timing,   fixed delay per access
+ *   MEMORY_TIMING_BANKED    banked_timing, interleaved banks
+ *   MEMORY_TIMING_DRAM      dram_timing,   DRAM with row buffer state
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_memory_timing_h_
+#define _tlm_demo2_memory_timing_h_
+
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+
+
+//------------------------------------------------------------------------------
+//! Flat timing, every read and write takes the same time.
+//------------------------------------------------------------------------------
+class flat_timing
+{
+public:
+    
+    flat_timing()
+    : read_delay(5, sc_core::SC_NS), write_delay(5, sc_core::SC_NS) {}
+    
+    //--------------------------------------------------------------------------
+    //! Adds the access delay to the annotated delay of a transaction.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //! @param delay   How far the initiator is beyond baseline SystemC time.
+    //--------------------------------------------------------------------------
+    void annotate(tlm::tlm_command cmd, sc_dt::uint64 addr, sc_core::sc_time& delay)
+    {
+        switch( cmd )
+        {
+            case tlm::TLM_READ_COMMAND:
+                // Represent the delay to access one byte data for read
+                delay += read_delay;
+                break;
+            case tlm::TLM_WRITE_COMMAND:
+                // Represent the delay to access one byte data for write
+                delay += write_delay;
+                break;
+            case tlm::TLM_IGNORE_COMMAND:
+                delay = sc_core::SC_ZERO_TIME;
+                break;
+        }
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Delay of an access without changing any state, e.g. for DMI.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //--------------------------------------------------------------------------
+    sc_core::sc_time latency(tlm::tlm_command cmd, sc_dt::uint64 addr) const
+    {
+        return (cmd == tlm::TLM_WRITE_COMMAND) ? write_delay : read_delay;
+    }
+    
+    //! Delay of a read access.
+    sc_core::sc_time read_delay;
+    
+    //! Delay of a write access.
+    sc_core::sc_time write_delay;
+};
+
+
+//------------------------------------------------------------------------------
+//! Interleaved banks, accesses to different banks overlap in time.
+//
+//! The address space is interleaved over the banks with the given granularity,
+//! e.g. a cache line or a page. Each bank remembers when it becomes free. An
+//! access arriving at a busy bank is delayed until the bank is free, then it
+//! takes the access time and occupies the bank for the busy time. All of this
+//! is computed from the annotated time of the transaction, no process or wait
+//! is involved.
+//
+//! Limitation: the banks are shared by all initiators, which under temporal
+//! decoupling run ahead of each other by up to a quantum. An access of an
+//! initiator behind finds banks occupied in its future by an initiator ahead
+//! and would wait up to a quantum for a conflict that never happened. The
+//! wait is therefore limited to ::max_wait, the busy time by default, and the
+//! conflicts between decoupled initiators are an estimate. Use a quantum in
+//! the range of the busy time for exact conflicts.
+//------------------------------------------------------------------------------
+class banked_timing
+{
+public:
+    
+    //! Interleaving granularities in bytes.
+    enum { CACHE_LINE = 64, PAGE = 4096 };
+    
+    banked_timing()
+    : access_time(5, sc_core::SC_NS), busy_time(10, sc_core::SC_NS),
+      max_wait(10, sc_core::SC_NS), n_conflicts(0), n_limited(0)
+    {
+        set_banks(4, CACHE_LINE);
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Sets the bank organisation and marks all banks as free.
+    //
+    //! @param n            Number of banks
+    //! @param granularity  Interleaving granularity in bytes
+    //--------------------------------------------------------------------------
+    void set_banks(unsigned int n, sc_dt::uint64 granularity)
+    {
+        n_banks = n ? n : 1;
+        interleave = granularity ? granularity : 1;
+        bank_free.assign(n_banks, sc_core::SC_ZERO_TIME);
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Adds the access delay to the annotated delay of a transaction.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //! @param delay   How far the initiator is beyond baseline SystemC time.
+    //--------------------------------------------------------------------------
+    void annotate(tlm::tlm_command cmd, sc_dt::uint64 addr, sc_core::sc_time& delay)
+    {
+        if (cmd == tlm::TLM_IGNORE_COMMAND) return;
+        
+        sc_core::sc_time& free   = bank_free[(addr / interleave) % n_banks];
+        sc_core::sc_time  arrive = sc_core::sc_time_stamp() + delay;
+        
+        if (free > arrive)
+        {
+            // bank conflict, wait until the bank is free, at most max_wait
+            sc_core::sc_time stall = free - arrive;
+            if (stall > max_wait)
+            {
+                stall = max_wait;
+                n_limited++;
+            }
+            delay  += stall;
+            arrive += stall;
+            n_conflicts++;
+        }
+        
+        delay += access_time;
+        if (arrive + busy_time > free) free = arrive + busy_time;
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Delay of an access to a free bank, no bank state is changed.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //--------------------------------------------------------------------------
+    sc_core::sc_time latency(tlm::tlm_command cmd, sc_dt::uint64 addr) const
+    {
+        return access_time;
+    }
+    
+    //! Number of accesses delayed by a busy bank.
+    sc_dt::uint64 get_conflicts() const { return n_conflicts; }
+    
+    //! Of those, accesses whose wait was limited to ::max_wait.
+    sc_dt::uint64 get_limited_conflicts() const { return n_limited; }
+    
+    //! Time from the start of an access until the data is transferred.
+    sc_core::sc_time access_time;
+    
+    //! Time a bank is occupied by an access.
+    sc_core::sc_time busy_time;
+    
+    //! Longest wait for a busy bank, see the limitation above.
+    sc_core::sc_time max_wait;
+    
+private:
+    
+    //! Number of banks.
+    unsigned int n_banks;
+    
+    //! Interleaving granularity in bytes.
+    sc_dt::uint64 interleave;
+    
+    //! Time at which each bank becomes free.
+    std::vector<sc_core::sc_time> bank_free;
+    
+    //! Number of accesses delayed by a busy bank.
+    sc_dt::uint64 n_conflicts;
+    
+    //! Number of conflicts limited to ::max_wait.
+    sc_dt::uint64 n_limited;
+};
+
+
+//------------------------------------------------------------------------------
+//! Analytic DRAM timing with one open row per bank.
+//
+//! Consecutive rows of row_size bytes are interleaved over the banks. An
+//! access to the open row of its bank costs tCL, an access to a closed bank
+//! tRCD + tCL and an access to another row of the bank tRP + tRCD + tCL.
+//! Every tREFI all banks are refreshed: accesses arriving during the refresh
+//! wait for tRFC to pass and find their rows closed. The open rows are tagged
+//! with the refresh interval they were opened in, so the state update per
+//! access is O(1) for any number of banks.
+//------------------------------------------------------------------------------
+class dram_timing
+{
+public:
+    
+    dram_timing()
+    : tRCD(14, sc_core::SC_NS), tCL(14, sc_core::SC_NS), tRP(14, sc_core::SC_NS),
+      tREFI(7800, sc_core::SC_NS), tRFC(350, sc_core::SC_NS),
+      n_hits(0), n_empty(0), n_conflicts(0), n_refresh_waits(0)
+    {
+        set_geometry(8, 2048);
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Sets the number of banks and the row size and closes all rows.
+    //
+    //! @param banks     Number of banks
+    //! @param row_size  Bytes per row
+    //--------------------------------------------------------------------------
+    void set_geometry(unsigned int banks, sc_dt::uint64 row_size)
+    {
+        n_banks   = banks ? banks : 1;
+        row_bytes = row_size ? row_size : 1;
+        open_row.assign(n_banks, 0);
+        open_epoch.assign(n_banks, sc_dt::uint64(NO_ROW));
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Adds the access delay to the annotated delay of a transaction.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //! @param delay   How far the initiator is beyond baseline SystemC time.
+    //--------------------------------------------------------------------------
+    void annotate(tlm::tlm_command cmd, sc_dt::uint64 addr, sc_core::sc_time& delay)
+    {
+        if (cmd == tlm::TLM_IGNORE_COMMAND) return;
+        
+        sc_dt::uint64 line  = addr / row_bytes;
+        unsigned int  bank  = line % n_banks;
+        sc_dt::uint64 row   = line / n_banks;
+        
+        // refresh interval of the access, wait if it arrives during refresh
+        sc_dt::uint64 epoch = 0;
+        if (tREFI != sc_core::SC_ZERO_TIME)
+        {
+            sc_core::sc_time arrive = sc_core::sc_time_stamp() + delay;
+            epoch = arrive.value() / tREFI.value();
+            sc_core::sc_time since = arrive - tREFI * double(epoch);
+            if (epoch != 0 && since < tRFC)
+            {
+                delay += tRFC - since;
+                n_refresh_waits++;
+            }
+        }
+        
+        if (open_epoch[bank] != epoch)
+        {
+            delay += tRCD + tCL;            // bank closed
+            n_empty++;
+        }
+        else if (open_row[bank] == row)
+        {
+            delay += tCL;                   // row hit
+            n_hits++;
+        }
+        else
+        {
+            delay += tRP + tRCD + tCL;      // row conflict
+            n_conflicts++;
+        }
+        
+        open_row[bank]   = row;
+        open_epoch[bank] = epoch;
+    }
+    
+    //--------------------------------------------------------------------------
+    //! Delay of an access to a closed bank outside refresh, no row or
+    //! statistics are changed.
+    //
+    //! @param cmd     The TLM command
+    //! @param addr    The address of the access
+    //--------------------------------------------------------------------------
+    sc_core::sc_time latency(tlm::tlm_command cmd, sc_dt::uint64 addr) const
+    {
+        return tRCD + tCL;
+    }
+    
+    //! Number of accesses to an open row.
+    sc_dt::uint64 get_row_hits() const { return n_hits; }
+    
+    //! Number of accesses to a closed bank.
+    sc_dt::uint64 get_row_empty() const { return n_empty; }
+    
+    //! Number of accesses to another row than the open one.
+    sc_dt::uint64 get_row_conflicts() const { return n_conflicts; }
+    
+    //! Number of accesses delayed by a refresh.
+    sc_dt::uint64 get_refresh_waits() const { return n_refresh_waits; }
+    
+    //! Row activate to column access delay.
+    sc_core::sc_time tRCD;
+    
+    //! Column access latency.
+    sc_core::sc_time tCL;
+    
+    //! Row precharge time.
+    sc_core::sc_time tRP;
+    
+    //! Refresh interval, zero disables refresh.
+    sc_core::sc_time tREFI;
+    
+    //! Refresh cycle time.
+    sc_core::sc_time tRFC;
+    
+private:
+    
+    //! Epoch tag of a bank without open row.
+    static const sc_dt::uint64 NO_ROW = ~sc_dt::uint64(0);
+    
+    //! Number of banks.
+    unsigned int n_banks;
+    
+    //! Bytes per row.
+    sc_dt::uint64 row_bytes;
+    
+    //! Open row of each bank.
+    std::vector<sc_dt::uint64> open_row;
+    
+    //! Refresh interval in which the row of each bank was opened.
+    std::vector<sc_dt::uint64> open_epoch;
+    
+    //! Statistics.
+    sc_dt::uint64 n_hits;
+    sc_dt::uint64 n_empty;
+    sc_dt::uint64 n_conflicts;
+    sc_dt::uint64 n_refresh_waits;
+};
+
+
+#if defined(MEMORY_TIMING_BANKED)
+typedef banked_timing memory_timing;
+#elif defined(MEMORY_TIMING_DRAM)
+typedef dram_timing   memory_timing;
+#else
+typedef flat_timing   memory_timing;
+#endif
+
+#endif
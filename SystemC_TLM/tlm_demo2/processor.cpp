@@ -25,10 +25,62 @@ using namespace sc_core;
 //------------------------------------------------------------------------------
 processor::processor(sc_module_name  name):
 sc_module (name),
-data_bus("data_bus")
+data_bus("data_bus"),
+wc_busy(false),
+wc_flusher(false)
 {
-    //! Defines the function ::program_main() as a SystemC thread.
-    SC_THREAD (program_main);
+    //! Attaches the transaction tags to the payloads, once for all transactions.
+    tags    = txn_attach(trans, this);
+    sg_tags = txn_attach(sg_trans, this);
+    wc_tags = txn_attach(wc_trans, this);
+    
+    //! Runs the function ::program_main() in a SystemC thread.
+    SC_THREAD (program_thread);
+}
+
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread of the processor. Runs ::program_main(), the writes still
+//! buffered when it returns are flushed before the processor is idle.
+// -----------------------------------------------------------------------------
+void processor::program_thread()
+{
+    program_main();
+    
+    sc_time delay = SC_ZERO_TIME;
+    flush_writes(write_combiner::FLUSH_END, delay);
+    PROF_WAIT(delay);
+}
+
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread flushing the buffered line at its timeout, also while
+//! the program does not access the bus. It is spawned by set_write_combining(),
+//! a processor without write combining has no such thread. ::wc_expire is
+//! notified for the deadline of each new line, a line flushed before is not
+//! flushed again.
+// -----------------------------------------------------------------------------
+void processor::flush_thread()
+{
+    while (true)
+    {
+        wait(wc_expire);
+        
+        sc_time now = sc_time_stamp();
+        if (!wc.pending()) continue;
+        if (!wc.expired(now))
+        {
+            // the line was replaced by a later one
+            if (wc.timeout != SC_ZERO_TIME) wc_expire.notify(wc.deadline() - now);
+            continue;
+        }
+        
+        sc_time delay = SC_ZERO_TIME;
+        flush_writes(write_combiner::FLUSH_TIMEOUT, delay);
+        PROF_WAIT(delay);
+    }
 }
 
 
@@ -50,8 +102,20 @@ int processor::bus_readwrite(tlm::tlm_command  cmd,
                               uint8_t*          data_ptr,
                               uint8_t*          byte_en_ptr)
 {
-    // Initialize 8 out of the 10 attributes,
-    // byte_enable_length and extensions being unused
+    PROF_SCOPE("processor::bus_readwrite");
+    
+    //  time delay
+    sc_time delay    = SC_ZERO_TIME;
+    
+    // a buffered write completes without a transaction
+    if (combine_access(cmd, addr, data_len, data_ptr, byte_en_ptr, delay))
+    {
+        PROF_WAIT(delay);
+        return 0;
+    }
+    
+    // Initialize 8 out of the 10 attributes, byte_enable_length being unused,
+    // the extensions are the transaction tags
     trans.set_command(cmd);
     trans.set_address(addr);
     trans.set_data_ptr(data_ptr);
@@ -61,14 +125,13 @@ int processor::bus_readwrite(tlm::tlm_command  cmd,
     trans.set_dmi_allowed(false);
     trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
     
-    //  time delay
-    sc_time delay    = SC_ZERO_TIME;
+    txn_stamp(tags, delay);
     
     // Blocking transport call
     data_bus->b_transport(trans, delay);
     
     // wait transmission delay
-    wait(delay);
+    PROF_WAIT(delay);
     
     // For now just simple non-zero return code on error 
     return  trans.is_response_ok () ? 0 : -1;
@@ -76,6 +139,281 @@ int processor::bus_readwrite(tlm::tlm_command  cmd,
 
 
 
+// ----------------------------------------------------------------------------
+//! Reads or writes all segments of sg in one blocking transport call, e.g. to
+//! gather scattered data words at the cost of a single transaction.
+//
+//! The extension is set on the carrier payload for the duration of the call.
+//! If the target does not know it, the segments are transferred one by one,
+//! see sg_transport().
+//
+//! @param  sg   The command and segments, the segment responses are returned
+//
+//! @return  Zero if all segments succeeded. A return code otherwise.
+// ----------------------------------------------------------------------------
+int processor::bus_scatter_gather(sg_extension& sg)
+{
+    PROF_SCOPE("processor::bus_scatter_gather");
+    
+    //  time delay, accumulated over all segments
+    sc_time delay    = SC_ZERO_TIME;
+    
+    int status = transport_scatter_gather(sg_trans, sg_tags, sg, delay);
+    
+    // wait transmission delay
+    PROF_WAIT(delay);
+    
+    return status;
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Scatter-gather transaction of all segments of sg, see bus_scatter_gather().
+//
+//! The delays of the segments are added to delay, the caller waits for it or
+//! keeps it as its local time offset.
+//
+//! @param  carrier       The carrier payload, not in flight
+//! @param  carrier_tags  The transaction tags attached to the carrier
+//! @param  sg            The command and segments, the segment responses are
+//!                       returned
+//! @param  delay         The annotated delay
+//
+//! @return  Zero if all segments succeeded. A return code otherwise.
+// ----------------------------------------------------------------------------
+int processor::transport_scatter_gather(tlm::tlm_generic_payload& carrier,
+                                        const txn_tags&           carrier_tags,
+                                        sg_extension&             sg,
+                                        sc_time&                  delay)
+{
+    sg.executed = false;
+    
+    carrier.set_command(tlm::TLM_IGNORE_COMMAND);
+    carrier.set_address(sg.segments.empty() ? 0 : sg.segments[0].addr);
+    carrier.set_data_ptr(0);
+    carrier.set_data_length(0);
+    carrier.set_streaming_width(0);
+    carrier.set_byte_enable_ptr(0);
+    carrier.set_dmi_allowed(false);
+    carrier.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    carrier.set_extension(&sg);
+    
+    txn_stamp(carrier_tags, delay);
+    
+    // Blocking transport call
+    sg_transport(data_bus, carrier, delay);
+    
+    // the extension is owned by the caller
+    carrier.clear_extension(&sg);
+    
+    return  carrier.is_response_ok () ? 0 : -1;
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Enables or disables the write-combining buffer, see write_combiner.h.
+//
+//! Call it before the simulation starts, buffered writes are dropped. A line
+//! size that is not a power of two of at least 4 is an error. The first call
+//! enabling write combining spawns ::flush_thread().
+//
+//! @param  line_bytes  Line size, a power of two of at least 4, zero disables
+//! @param  timeout     Flush a line after its first write is this old, zero
+//!                     for no timeout, the line is then kept until the next
+//!                     flush by an access, a sync or the end of the program
+// ----------------------------------------------------------------------------
+void processor::set_write_combining(unsigned int line_bytes, const sc_time& timeout)
+{
+    if (!wc.set_line(line_bytes))
+    {
+        SC_REPORT_ERROR(name(), "the write-combining line size must be a power of two of at least 4 bytes");
+    }
+    wc.timeout = timeout;
+    
+    if (wc.enabled() && !wc_flusher)
+    {
+        std::string flusher = std::string(basename()) + "_wc_flush";
+        sc_spawn(sc_bind(&processor::flush_thread, this),
+                 sc_gen_unique_name(flusher.c_str()));
+        wc_flusher = true;
+    }
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Passes an access of bus_readwrite() through the write-combining buffer.
+//
+//! A write merged into the buffer is posted: it completes at once and the
+//! caller issues no transaction. A line whose timeout expired is flushed
+//! first, the line is also flushed at its timeout by ::flush_thread() when no
+//! access comes. A write to another line flushes the buffered one, and a read
+//! overlapping the buffered line flushes it before the read is issued. The
+//! delays of the flushes are added to delay. A failed burst is counted by
+//! the buffer, the posted writes can not report it.
+//
+//! @param  cmd           The TLM access command, read or write
+//! @param  addr          The address for the access
+//! @param  data_len      The number of bytes to access
+//! @param  data_ptr      Vector for the access data
+//! @param  byte_en_ptr   The byte enable mask for the access
+//! @param  delay         The annotated delay
+//
+//! @return  True if the write was buffered, false if the access is issued.
+// ----------------------------------------------------------------------------
+bool processor::combine_access(tlm::tlm_command  cmd,
+                               uint64_t          addr,
+                               int               data_len,
+                               uint8_t*          data_ptr,
+                               uint8_t*          byte_en_ptr,
+                               sc_time&          delay)
+{
+    if (!wc.enabled()) return false;
+    
+    if (wc.expired(sc_time_stamp() + delay))
+    {
+        flush_writes(write_combiner::FLUSH_TIMEOUT, delay);
+    }
+    
+    if (cmd == tlm::TLM_READ_COMMAND)
+    {
+        if (wc.overlaps(addr, data_len)) flush_writes(write_combiner::FLUSH_READ, delay);
+        return false;
+    }
+    if (cmd != tlm::TLM_WRITE_COMMAND) return false;
+    
+    if (buffer_write(addr, data_len, data_ptr, byte_en_ptr, delay)) return true;
+    if (!wc.pending()) return false;
+    
+    flush_writes(write_combiner::FLUSH_LINE, delay);
+    return buffer_write(addr, data_len, data_ptr, byte_en_ptr, delay);
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Merges a write into the buffer, see write_combiner::add(). A write starting
+//! a new line notifies ::wc_expire at the deadline of the line.
+//
+//! @return  True if the write was buffered.
+// ----------------------------------------------------------------------------
+bool processor::buffer_write(uint64_t  addr,
+                             int       data_len,
+                             uint8_t*  data_ptr,
+                             uint8_t*  byte_en_ptr,
+                             sc_time&  delay)
+{
+    bool new_line = !wc.pending();
+    
+    if (!wc.add(addr, data_len, data_ptr, byte_en_ptr, sc_time_stamp() + delay)) return false;
+    
+    if (new_line && wc.pending() && wc.timeout != SC_ZERO_TIME)
+    {
+        wc_expire.notify(wc.deadline() - sc_time_stamp());
+    }
+    return true;
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Issues the buffered line as one scatter-gather burst and empties the buffer.
+//
+//! The program and ::flush_thread() both flush. A flush waits for the burst
+//! of the other one to complete, so the bursts are issued in order.
+//
+//! @param  reason  Why the line is flushed, for the statistics
+//! @param  delay   The annotated delay, the delay of the burst is added
+//
+//! @return  Zero if the burst succeeded or nothing was buffered.
+// ----------------------------------------------------------------------------
+int processor::flush_writes(write_combiner::flush_e reason, sc_time& delay)
+{
+    while (wc_busy) wait(wc_idle);
+    if (!wc.pending()) return 0;
+    
+    wc_busy = true;
+    int status = transport_scatter_gather(wc_trans, wc_tags, wc.burst(reason), delay);
+    if (status != 0) wc.failed();
+    wc_busy = false;
+    wc_idle.notify();
+    return status;
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Writes the buffered writes by debug transport and empties the buffer, e.g.
+//! after sc_start() returned at the end of the simulated time while writes of
+//! a program still running are buffered. No burst is counted.
+// ----------------------------------------------------------------------------
+void processor::drain_writes()
+{
+    wc.drain([this](sc_dt::uint64 addr, const uint8_t* data, unsigned int len) {
+        debug_write(addr, data, len);
+    });
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Callback at the end of the simulation, see drain_writes().
+// ----------------------------------------------------------------------------
+void processor::end_of_simulation()
+{
+    drain_writes();
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Debug transport through the data bus, without timing and from any context,
+//! e.g. to load a program or to inspect the memory from sc_main.
+//
+//! @param  cmd           The TLM access command, read or write
+//! @param  addr          The address for the access
+//! @param  data_ptr      Buffer for the access data
+//! @param  len           The number of bytes to transfer, any length
+//
+//! @return  The number of bytes transferred by the target.
+// ----------------------------------------------------------------------------
+unsigned int processor::debug_transport(tlm::tlm_command  cmd,
+                                        uint64_t          addr,
+                                        uint8_t*          data_ptr,
+                                        unsigned int      len)
+{
+    dbg_trans.set_command(cmd);
+    dbg_trans.set_address(addr);
+    dbg_trans.set_data_ptr(data_ptr);
+    dbg_trans.set_data_length(len);
+    
+    return data_bus->transport_dbg(dbg_trans);
+}
+
+
+// ----------------------------------------------------------------------------
+//! Debug read of len bytes from addr into data.
+// ----------------------------------------------------------------------------
+unsigned int processor::debug_read(uint64_t addr, uint8_t* data, unsigned int len)
+{
+    return debug_transport(tlm::TLM_READ_COMMAND, addr, data, len);
+}
+
+
+// ----------------------------------------------------------------------------
+//! Debug write of len bytes from data to addr.
+// ----------------------------------------------------------------------------
+unsigned int processor::debug_write(uint64_t addr, const uint8_t* data,
+                                    unsigned int len)
+{
+    return debug_transport(tlm::TLM_WRITE_COMMAND, addr,
+                           const_cast<uint8_t*>(data), len);
+}
+
+
+
 // -----------------------------------------------------------------------------
 //! The SystemC thread running the TLM access tests of the example.
 //
@@ -17,6 +17,10 @@
 #include "systemc"
 #include "tlm.h"
 #include "tlm_utils/simple_initiator_socket.h"
+#include "host_profiler.h"
+#include "sg_extension.h"
+#include "txn_extensions.h"
+#include "write_combiner.h"
 
 
 //------------------------------------------------------------------------------
@@ -31,12 +35,46 @@ public:
     
     // TLM-2 socket, defaults to 32-bits wide, base protocol
     tlm_utils::simple_initiator_socket<processor> data_bus;
+    
+    //! Debug read of len bytes from addr, no simulated time passes.
+    unsigned int debug_read(uint64_t addr, uint8_t* data, unsigned int len);
+    
+    //! Debug write of len bytes to addr, no simulated time passes.
+    unsigned int debug_write(uint64_t addr, const uint8_t* data, unsigned int len);
+    
+    //! Sets the quality of service class of the transactions.
+    void set_qos(uint8_t qos)
+    {
+        tags.qos->qos    = qos;
+        sg_tags.qos->qos = qos;
+        wc_tags.qos->qos = qos;
+    }
+    
+    //! Enables write combining with lines of line_bytes, zero disables it.
+    void set_write_combining(unsigned int line_bytes,
+                             const sc_core::sc_time& timeout = sc_core::sc_time(100, sc_core::SC_NS));
+    
+    //! The write-combining buffer, for its statistics.
+    const write_combiner& get_write_combiner() const { return wc; }
+    
+    //! Writes the buffered writes by debug transport, no simulated time passes.
+    void drain_writes();
    
 protected:
     
-    //! SystemC Thread which will execute the TLM access tests of the example.
+    //! SystemC Thread running ::program_main(), flushes the buffer at its end.
+    void program_thread();
+    
+    //! The program of the processor, the tests of the example by default.
     virtual void program_main();
     
+    //! SystemC Thread flushing the buffered line when its timeout expires,
+    //! spawned when write combining is enabled.
+    void flush_thread();
+    
+    //! Drains the buffer when the simulation ends.
+    void end_of_simulation();
+    
     //! The blocking transport routine for the socket.
     virtual int bus_readwrite(tlm::tlm_command     cmd,
                       uint64_t             addr,
@@ -44,8 +82,79 @@ protected:
                       uint8_t*             data_ptr,
                       uint8_t*             byte_en_ptr);
     
+    //! Scatter-gather access of all segments of sg in one transaction.
+    virtual int bus_scatter_gather(sg_extension& sg);
+    
+    //! Scatter-gather transaction with the annotated delay, without waiting.
+    int transport_scatter_gather(tlm::tlm_generic_payload& carrier,
+                                 const txn_tags&           carrier_tags,
+                                 sg_extension&             sg,
+                                 sc_core::sc_time&         delay);
+    
+    //! Merges a write into the buffer, arms the timeout of a new line.
+    bool buffer_write(uint64_t          addr,
+                      int               data_len,
+                      uint8_t*          data_ptr,
+                      uint8_t*          byte_en_ptr,
+                      sc_core::sc_time& delay);
+    
+    //! Passes an access through the write-combining buffer.
+    bool combine_access(tlm::tlm_command     cmd,
+                        uint64_t             addr,
+                        int                  data_len,
+                        uint8_t*             data_ptr,
+                        uint8_t*             byte_en_ptr,
+                        sc_core::sc_time&    delay);
+    
+    //! Issues the buffered writes as one burst.
+    int flush_writes(write_combiner::flush_e reason, sc_core::sc_time& delay);
+    
+    //! Fence, the buffered writes are issued before any later access.
+    int write_fence(sc_core::sc_time& delay)
+    {
+        return flush_writes(write_combiner::FLUSH_FENCE, delay);
+    }
+    
+    //! The debug transport routine for the socket.
+    unsigned int debug_transport(tlm::tlm_command  cmd,
+                                 uint64_t          addr,
+                                 uint8_t*          data_ptr,
+                                 unsigned int      len);
+    
     //! The generic payload.
     tlm::tlm_generic_payload  trans;
+    
+    //! The transaction tags attached to ::trans.
+    txn_tags  tags;
+    
+    //! The carrier payload of scatter-gather transactions.
+    tlm::tlm_generic_payload  sg_trans;
+    
+    //! The transaction tags attached to ::sg_trans.
+    txn_tags  sg_tags;
+    
+    //! The generic payload of debug transactions, ::trans may be in flight.
+    tlm::tlm_generic_payload  dbg_trans;
+    
+    //! The write-combining buffer, disabled by default.
+    write_combiner  wc;
+    
+    //! The carrier payload of the bursts of ::wc, ::flush_thread() may issue
+    //! one while ::sg_trans is in flight.
+    tlm::tlm_generic_payload  wc_trans;
+    
+    //! The transaction tags attached to ::wc_trans.
+    txn_tags  wc_tags;
+    
+    //! Notified at the timeout of the buffered line.
+    sc_core::sc_event  wc_expire;
+    
+    //! True while a burst of ::wc is in flight, ::wc_idle is notified after it.
+    bool  wc_busy;
+    sc_core::sc_event  wc_idle;
+    
+    //! True once ::flush_thread() is spawned.
+    bool  wc_flusher;
 
 };
 
@@ -0,0 +1,225 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/reg_bank.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Memory mapped register bank module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "reg_bank.h"
+
+#include <string.h>
+
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the register bank
+//
+//! @param name  SystemC module name
+//! @param size  Size of the bank in bytes, a power of two
+//------------------------------------------------------------------------------
+reg_bank::reg_bank(sc_module_name name, unsigned int size) :
+sc_module (name), reg_bus("reg_bus"), latency(SC_ZERO_TIME),
+table(size, 0), addr_mask(size - 1), write_lanes(0)
+{
+    if (size == 0 || (size & (size - 1)) != 0)
+    {
+        SC_REPORT_ERROR("reg_bank", "the size must be a power of two");
+    }
+
+    reg_bus.register_b_transport(this, &reg_bank::bus_readwrite);
+    reg_bus.register_transport_dbg(this, &reg_bank::debug_transport);
+}
+
+
+//------------------------------------------------------------------------------
+//! Declares a register.
+//
+//! @param offset       Byte offset in the bank, a multiple of the width
+//! @param width        Width in bytes, 1, 2 or 4
+//! @param reset_value  Value after construction and reset()
+//! @param write_mask   Bits stored by a write
+//! @param on_read      Optional, returns the value read
+//! @param on_write     Optional, called after each write
+//------------------------------------------------------------------------------
+void reg_bank::add_register(uint32_t        offset,
+                            unsigned int    width,
+                            uint32_t        reset_value,
+                            uint32_t        write_mask,
+                            read_callback   on_read,
+                            write_callback  on_write)
+{
+    if ((width != 1 && width != 2 && width != 4) || offset % width != 0 ||
+        offset + width > table.size())
+    {
+        SC_REPORT_ERROR("reg_bank", "register outside the bank or misaligned");
+        return;
+    }
+    for (unsigned int i = 0; i < width; i++)
+    {
+        if (table[offset + i] != 0)
+        {
+            SC_REPORT_ERROR("reg_bank", "registers overlap");
+            return;
+        }
+    }
+
+    uint32_t width_mask = (width == 4) ? 0xFFFFFFFF : (1u << (8 * width)) - 1;
+
+    reg_entry r;
+    r.offset      = offset;
+    r.width       = width;
+    r.reset_value = reset_value & width_mask;
+    r.write_mask  = write_mask & width_mask;
+    r.on_read     = on_read;
+    r.on_write    = on_write;
+    r.value       = r.reset_value;
+    regs.push_back(r);
+
+    for (unsigned int i = 0; i < width; i++) table[offset + i] = regs.size();
+}
+
+
+//------------------------------------------------------------------------------
+//! Sets the read of a register for debug reads, instead of the stored value.
+//
+//! @param offset   Byte offset of a declared register
+//! @param on_peek  Returns the value without side effects, the delay is zero
+//------------------------------------------------------------------------------
+void reg_bank::set_peek(uint32_t offset, read_callback on_peek)
+{
+    if (offset >= table.size() || table[offset] == 0)
+    {
+        SC_REPORT_ERROR("reg_bank", "no register at the offset");
+        return;
+    }
+    regs[table[offset] - 1].on_peek = on_peek;
+}
+
+
+//------------------------------------------------------------------------------
+//! Sets all registers to their reset values, no callback is called.
+//------------------------------------------------------------------------------
+void reg_bank::reset()
+{
+    for (size_t i = 0; i < regs.size(); i++) regs[i].value = regs[i].reset_value;
+}
+
+
+//------------------------------------------------------------------------------
+//! Finds the register of an access.
+//
+//! @param payload  The generic TLM payload
+//! @param lane     First byte of the access within the register
+//
+//! @return The register, 0 if the access is not within one register
+//------------------------------------------------------------------------------
+reg_bank::reg_entry* reg_bank::decode(tlm::tlm_generic_payload& payload,
+                                      unsigned int& lane)
+{
+    uint32_t     offset = payload.get_address() & addr_mask;
+    unsigned int len    = payload.get_data_length();
+    uint16_t     index  = table[offset];
+
+    if (index == 0)
+    {
+        payload.set_response_status( tlm::TLM_ADDRESS_ERROR_RESPONSE );
+        return 0;
+    }
+
+    reg_entry& r = regs[index - 1];
+    lane = offset - r.offset;
+    if (len == 0 || lane + len > r.width || payload.get_streaming_width() < len)
+    {
+        payload.set_response_status( tlm::TLM_BURST_ERROR_RESPONSE );
+        return 0;
+    }
+    return &r;
+}
+
+
+//------------------------------------------------------------------------------
+//! Blocking transport callback function of the registers.
+//
+//! @param payload  The generic TLM payload
+//! @param delay    How far the initiator is beyond baseline SystemC time.
+//------------------------------------------------------------------------------
+void reg_bank::bus_readwrite( tlm::tlm_generic_payload& payload, sc_time& delay )
+{
+    tlm::tlm_command cmd = payload.get_command();
+
+    if (cmd == tlm::TLM_IGNORE_COMMAND)
+    {
+        payload.set_response_status( tlm::TLM_OK_RESPONSE );
+        return;
+    }
+    if (payload.get_byte_enable_ptr())
+    {
+        payload.set_response_status( tlm::TLM_BYTE_ENABLE_ERROR_RESPONSE );
+        return;
+    }
+
+    unsigned int lane;
+    reg_entry*   r = decode(payload, lane);
+    if (!r) return;
+
+    unsigned int len = payload.get_data_length();
+
+    // registers are kept in host byte order, as the memory array
+    if (cmd == tlm::TLM_READ_COMMAND)
+    {
+        uint32_t value = r->on_read ? r->on_read(delay) : r->value;
+        memcpy(payload.get_data_ptr(), reinterpret_cast<uint8_t*>(&value) + lane, len);
+    }
+    else
+    {
+        uint32_t data  = 0;
+        uint32_t lanes = 0;
+        memcpy(reinterpret_cast<uint8_t*>(&data)  + lane, payload.get_data_ptr(), len);
+        memset(reinterpret_cast<uint8_t*>(&lanes) + lane, 0xFF, len);
+
+        uint32_t mask = r->write_mask & lanes;
+        r->value = (r->value & ~mask) | (data & mask);
+        if (r->on_write)
+        {
+            write_lanes = lanes;
+            r->on_write(data, delay);
+        }
+    }
+
+    delay += latency;
+    payload.set_response_status( tlm::TLM_OK_RESPONSE );
+}
+
+
+//------------------------------------------------------------------------------
+//! Debug transport callback function, reads through the peek callbacks or the
+//! stored values and writes the stored values only, no callback with side
+//! effects is called.
+//
+//! @return  The number of bytes read or written
+//------------------------------------------------------------------------------
+unsigned int reg_bank::debug_transport( tlm::tlm_generic_payload& payload )
+{
+    unsigned int lane;
+    reg_entry*   r = decode(payload, lane);
+    if (!r) return 0;
+
+    unsigned int len = payload.get_data_length();
+
+    if (payload.get_command() == tlm::TLM_READ_COMMAND)
+    {
+        uint32_t value = r->on_peek ? r->on_peek(SC_ZERO_TIME) : r->value;
+        memcpy(payload.get_data_ptr(), reinterpret_cast<uint8_t*>(&value) + lane, len);
+    }
+    else if (payload.get_command() == tlm::TLM_WRITE_COMMAND)
+    {
+        memcpy(reinterpret_cast<uint8_t*>(&r->value) + lane, payload.get_data_ptr(), len);
+    }
+    return len;
+}
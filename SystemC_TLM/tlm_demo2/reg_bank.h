@@ -0,0 +1,129 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/reg_bank.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Memory mapped register bank module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_reg_bank_h_
+#define _tlm_demo2_reg_bank_h_
+
+#include <functional>
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_target_socket.h"
+
+
+//------------------------------------------------------------------------------
+//! Base of memory mapped peripherals, a bank of declared registers.
+//
+//! A peripheral declares its registers with add_register() in its constructor
+//! instead of writing a b_transport with a switch on the address. The bank
+//! spans size bytes, a power of two, and the address is taken modulo size.
+//
+//! Each access is dispatched through a table with one entry per byte offset of
+//! the bank, so finding the register is one indexed load, whatever the number
+//! of registers. An access may read or write any bytes within one register,
+//! otherwise it gets an address or burst error.
+//
+//! - Read: the value is returned by the read callback, or is the stored value.
+//! - Write: the bits set in the write mask are stored, then the write callback
+//!   gets the written data, zero in the bytes not accessed. Read-only,
+//!   write-one-to-clear or command registers have a mask of 0 and act in
+//!   the callback. A callback storing the data itself keeps the bytes not
+//!   accessed with merge_write().
+//
+//! The callbacks get the local time offset of the initiator: the time of the
+//! access is sc_time_stamp() + delay. ::latency is added to the delay.
+//! Debug accesses have no side effects: reads return the value of the peek
+//! callback set with set_peek(), or the stored value, and never call the read
+//! callback. Debug writes only store the value.
+//------------------------------------------------------------------------------
+class reg_bank : public sc_core::sc_module
+{
+public:
+
+    //! Returns the value of a register read at the given local time offset.
+    typedef std::function<uint32_t (const sc_core::sc_time& delay)> read_callback;
+
+    //! Acts on the data written to a register at the given local time offset.
+    typedef std::function<void (uint32_t data, sc_core::sc_time& delay)> write_callback;
+
+    //! Class Construct
+    reg_bank(sc_core::sc_module_name name, unsigned int size);
+
+    //! TLM-2 socket of the registers.
+    tlm_utils::simple_target_socket<reg_bank> reg_bus;
+
+    //! Delay annotated per access.
+    sc_core::sc_time latency;
+
+    //! Declares a register.
+    void add_register(uint32_t        offset,
+                      unsigned int    width,
+                      uint32_t        reset_value,
+                      uint32_t        write_mask,
+                      read_callback   on_read  = read_callback(),
+                      write_callback  on_write = write_callback());
+
+    //! Sets the side effect free read of a register for debug reads.
+    void set_peek(uint32_t offset, read_callback on_peek);
+
+    //! Sets all registers to their reset values.
+    void reset();
+
+protected:
+
+    //! Stored value of the register at offset.
+    uint32_t& reg(uint32_t offset) { return regs[table[offset] - 1].value; }
+
+    //! In a write callback, old with the bytes of data accessed by the write.
+    uint32_t merge_write(uint32_t old, uint32_t data) const
+    {
+        return (old & ~write_lanes) | (data & write_lanes);
+    }
+
+private:
+
+    //! A declared register.
+    struct reg_entry
+    {
+        uint32_t        offset;
+        unsigned int    width;
+        uint32_t        reset_value;
+        uint32_t        write_mask;
+        read_callback   on_read;
+        write_callback  on_write;
+        read_callback   on_peek;
+        uint32_t        value;
+    };
+
+    //! Blocking transport routine of the register socket.
+    void bus_readwrite(tlm::tlm_generic_payload& payload, sc_core::sc_time& delay);
+
+    //! Debug transport routine of the register socket.
+    unsigned int debug_transport(tlm::tlm_generic_payload& payload);
+
+    //! Finds the register of an access, 0 with the error response if none.
+    reg_entry* decode(tlm::tlm_generic_payload& payload, unsigned int& lane);
+
+    //! The declared registers.
+    std::vector<reg_entry> regs;
+
+    //! Index + 1 into ::regs per byte offset, 0 if no register.
+    std::vector<uint16_t> table;
+
+    //! Size of the bank in bytes - 1, the address mask.
+    uint32_t addr_mask;
+
+    //! Bits of the bytes accessed by the write being dispatched.
+    uint32_t write_lanes;
+};
+
+#endif
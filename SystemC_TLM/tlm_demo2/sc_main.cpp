@@ -31,6 +31,16 @@ int sc_main(int argc, char* argv[])
     // run forever
     sc_core::sc_start();
     
+    // inspect the test data with a debug transaction, no time passes
+    uint8_t dump[12];
+    unsigned int n = i_processor->debug_read(0x00, dump, sizeof(dump));
+    cout << "\n(Debug) " << dec << n << " bytes at 0x00000000:";
+    for (unsigned int i = 0; i < n; i++)
+    {
+        cout << " " << setw(2) << setfill('0') << hex << uppercase << int(dump[i]);
+    }
+    cout << endl;
+    
     
     // print simulation performance
     cout << "\n\n\n";
@@ -0,0 +1,155 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/sg_extension.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Scatter-gather extension of the generic payload
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_sg_extension_h_
+#define _tlm_demo2_sg_extension_h_
+
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+
+
+//------------------------------------------------------------------------------
+//! One segment of a scatter-gather transaction.
+//------------------------------------------------------------------------------
+struct sg_segment
+{
+    sc_dt::uint64             addr;     //!< Address
+    unsigned int              length;   //!< Data length
+    unsigned char*            data;     //!< Data buffer of the initiator
+    unsigned char*            byte_en;  //!< Byte enables of length bytes, or 0
+    tlm::tlm_response_status  status;   //!< Response of this segment
+};
+
+
+//------------------------------------------------------------------------------
+//! Payload extension carrying a list of segments, all read or all written in
+//! one b_transport call.
+//
+//! The carrier payload has the TLM_IGNORE_COMMAND, so a target not knowing the
+//! extension does nothing and completes it. A target knowing it executes all
+//! segments, adds their delays to the one delay argument and sets ::executed.
+//! Otherwise the caller of b_transport executes the segments one by one with
+//! the carrier, see sg_transport(). The carrier response is the first error
+//! of a segment, or OK.
+//
+//! The extension is owned by the initiator and reused. It is set on the
+//! carrier only for the duration of the call, so no extension is allocated
+//! per transaction.
+//------------------------------------------------------------------------------
+class sg_extension : public tlm::tlm_extension<sg_extension>
+{
+public:
+
+    //! Class constructor
+    sg_extension() : command(tlm::TLM_READ_COMMAND), executed(false) {}
+
+    //! Command of all segments, read or write.
+    tlm::tlm_command command;
+
+    //! The segments in execution order.
+    std::vector<sg_segment> segments;
+
+    //! Set by the target that executed the segments.
+    bool executed;
+
+    //! Appends a segment.
+    void add(sc_dt::uint64 addr, unsigned int length, unsigned char* data,
+             unsigned char* byte_en = 0)
+    {
+        sg_segment s = { addr, length, data, byte_en, tlm::TLM_INCOMPLETE_RESPONSE };
+        segments.push_back(s);
+    }
+
+    //! Removes all segments, the capacity is kept.
+    void clear() { segments.clear(); }
+
+    tlm::tlm_extension_base* clone() const { return new sg_extension(*this); }
+
+    void copy_from(const tlm::tlm_extension_base& ext)
+    {
+        *this = static_cast<const sg_extension&>(ext);
+    }
+};
+
+
+//------------------------------------------------------------------------------
+//! Sets the carrier response from the segment responses.
+//------------------------------------------------------------------------------
+inline void sg_set_response(tlm::tlm_generic_payload& carrier,
+                            const sg_extension& ext)
+{
+    carrier.set_response_status( tlm::TLM_OK_RESPONSE );
+    for (size_t i = 0; i < ext.segments.size(); i++)
+    {
+        if (ext.segments[i].status != tlm::TLM_OK_RESPONSE)
+        {
+            carrier.set_response_status( ext.segments[i].status );
+            return;
+        }
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Forwards a payload on an initiator socket, scatter-gather or not.
+//
+//! If the payload carries an sg_extension the target did not execute, its
+//! segments are executed one by one with the carrier itself, the extension
+//! being removed meanwhile. The carrier is restored afterwards, so the
+//! fallback does not allocate.
+//
+//! @param socket  Initiator socket, or anything with b_transport behind ->
+//! @param trans   The payload
+//! @param delay   The annotated delay, accumulated over all segments
+//------------------------------------------------------------------------------
+template <class SOCKET>
+void sg_transport(SOCKET& socket, tlm::tlm_generic_payload& trans,
+                  sc_core::sc_time& delay)
+{
+    sg_extension* ext = 0;
+    trans.get_extension(ext);
+
+    socket->b_transport(trans, delay);
+
+    if (ext == 0 || ext->executed) return;
+
+    trans.clear_extension(ext);
+    trans.set_command(ext->command);
+
+    for (size_t i = 0; i < ext->segments.size(); i++)
+    {
+        sg_segment& s = ext->segments[i];
+        trans.set_address(s.addr);
+        trans.set_data_ptr(s.data);
+        trans.set_data_length(s.length);
+        trans.set_streaming_width(s.length);
+        trans.set_byte_enable_ptr(s.byte_en);
+        trans.set_byte_enable_length(s.byte_en ? s.length : 0);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+        socket->b_transport(trans, delay);
+        s.status = trans.get_response_status();
+    }
+
+    trans.set_command(tlm::TLM_IGNORE_COMMAND);
+    trans.set_data_ptr(0);
+    trans.set_data_length(0);
+    trans.set_byte_enable_ptr(0);
+    trans.set_byte_enable_length(0);
+    trans.set_extension(ext);
+
+    ext->executed = true;
+    sg_set_response(trans, *ext);
+}
+
+#endif
@@ -0,0 +1,71 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/sim_mode.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Global simulation mode, functional fast-forward or timed
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_sim_mode_h_
+#define _tlm_demo2_sim_mode_h_
+
+#include "systemc"
+
+
+//------------------------------------------------------------------------------
+//! Global simulation mode.
+//
+//! In TIMED mode all models compute and annotate their timing. In FUNCTIONAL
+//! mode the targets skip their timing annotation and grant no DMI, and the
+//! processors skip the per instruction time accounting: each core executes a
+//! fixed number of instructions per global quantum and then yields until the
+//! next quantum.
+//! The mode can be changed at any time, e.g. between two calls of sc_start()
+//! to fast-forward through the boot and measure only the region of interest.
+//! Processors pick up a change at their next quantum sync.
+//------------------------------------------------------------------------------
+class sim_mode
+{
+public:
+    
+    //! Simulation modes.
+    enum mode_e { TIMED, FUNCTIONAL };
+    
+    //! The simulation mode of the simulation.
+    static sim_mode& instance()
+    {
+        static sim_mode the_mode;
+        return the_mode;
+    }
+    
+    //! Sets the simulation mode.
+    void set(mode_e m) { mode = m; }
+    
+    //! Current simulation mode.
+    mode_e get() const { return mode; }
+    
+    //! True in TIMED mode.
+    bool is_timed() const { return mode == TIMED; }
+    
+    //! Sets the instructions a core executes per quantum in FUNCTIONAL mode.
+    void set_functional_instructions(sc_dt::uint64 n) { ff_instructions = n ? n : 1; }
+    
+    //! Instructions a core executes per quantum in FUNCTIONAL mode.
+    sc_dt::uint64 get_functional_instructions() const { return ff_instructions; }
+    
+private:
+    
+    sim_mode() : mode(TIMED), ff_instructions(1000) {}
+    
+    //! Current simulation mode.
+    mode_e mode;
+    
+    //! Instructions per quantum in FUNCTIONAL mode.
+    sc_dt::uint64 ff_instructions;
+};
+
+#endif
@@ -0,0 +1,134 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/speed_monitor.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Live simulation speed monitor implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#include "speed_monitor.h"
+
+#include <chrono>
+
+using namespace std;
+
+typedef chrono::steady_clock host_clock;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor, the monitor is stopped.
+//------------------------------------------------------------------------------
+speed_monitor::speed_monitor() :
+stopping(false), interval(1), out(stderr), resolution(0),
+last_time(0), last_transactions(0), last_instructions(0), last_syncs(0)
+{
+}
+
+speed_monitor::~speed_monitor()
+{
+    stop();
+}
+
+
+//------------------------------------------------------------------------------
+//! Starts the reporting thread, call it from sc_main before sc_start().
+//
+//! @param interval  Wall-clock seconds between two reports
+//! @param out       Output, e.g. stderr or a file opened by the caller
+//------------------------------------------------------------------------------
+void speed_monitor::start(double interval, FILE* out)
+{
+    if (thread.joinable()) return;
+
+    speed_counters& c = speed_counters::instance();
+
+    this->interval    = interval;
+    this->out         = out;
+    resolution        = sc_core::sc_get_time_resolution().to_seconds();
+    last_time         = c.sim_time.load();
+    last_transactions = c.n_transactions.load();
+    last_instructions = c.n_instructions.load();
+    last_syncs        = c.n_syncs.load();
+    stopping          = false;
+
+    fprintf(out, "%10s %14s %12s %12s %12s %12s %12s\n", "host s", "sim s",
+            "sim/host", "txn/s", "instr/s", "syncs/s", "syncs");
+    fflush(out);
+
+    thread = std::thread(&speed_monitor::run, this);
+}
+
+
+//------------------------------------------------------------------------------
+//! Stops the reporting thread.
+//------------------------------------------------------------------------------
+void speed_monitor::stop()
+{
+    if (!thread.joinable()) return;
+    {
+        lock_guard<mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_one();
+    thread.join();
+}
+
+
+//------------------------------------------------------------------------------
+//! The reporting thread, one report per interval until stopped.
+//------------------------------------------------------------------------------
+void speed_monitor::run()
+{
+    host_clock::time_point t_start = host_clock::now();
+    host_clock::time_point t_last  = t_start;
+    host_clock::duration   period  =
+        chrono::duration_cast<host_clock::duration>(chrono::duration<double>(interval));
+
+    unique_lock<mutex> guard(lock);
+    while (!stopping)
+    {
+        wake.wait_until(guard, t_last + period);
+
+        host_clock::time_point t_now = host_clock::now();
+        double dt = chrono::duration<double>(t_now - t_last).count();
+        if (dt <= 0) continue;
+
+        report(chrono::duration<double>(t_now - t_start).count(), dt);
+        t_last = t_now;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the counts of the last dt seconds.
+//
+//! @param t_host  Host seconds since start()
+//! @param dt      Host seconds since the last report
+//------------------------------------------------------------------------------
+void speed_monitor::report(double t_host, double dt)
+{
+    speed_counters& c = speed_counters::instance();
+
+    sc_dt::uint64 sim_time     = c.sim_time.load(memory_order_relaxed);
+    sc_dt::uint64 transactions = c.n_transactions.load(memory_order_relaxed);
+    sc_dt::uint64 instructions = c.n_instructions.load(memory_order_relaxed);
+    sc_dt::uint64 syncs        = c.n_syncs.load(memory_order_relaxed);
+
+    fprintf(out, "%10.1f %14.9f %12.3e %12.3e %12.3e %12.3e %12llu\n",
+            t_host, sim_time * resolution,
+            (sim_time - last_time) * resolution / dt,
+            (transactions - last_transactions) / dt,
+            (instructions - last_instructions) / dt,
+            (syncs - last_syncs) / dt,
+            (unsigned long long) syncs);
+    fflush(out);
+
+    last_time         = sim_time;
+    last_transactions = transactions;
+    last_instructions = instructions;
+    last_syncs        = syncs;
+}
@@ -0,0 +1,154 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/speed_monitor.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Live simulation speed monitor
+ *
+ * The models count into speed_counters, which is header-only and costs a
+ * relaxed atomic add per event. The models count through SPEED_COUNT, which
+ * is empty unless SPEED_MONITOR is defined, so programs not reading the
+ * counters pay nothing. Only programs starting a speed_monitor link
+ * speed_monitor.cpp and the thread library.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_speed_monitor_h_
+#define _tlm_demo2_speed_monitor_h_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include "systemc"
+
+
+//------------------------------------------------------------------------------
+//! Progress counters of the simulation, written by the models.
+//
+//! The counters are atomics so that the monitor thread can read them while
+//! the simulation runs. The simulated time is published by the models as
+//! well, the monitor never calls into the SystemC kernel.
+//
+//! - transaction(): a target completed a transaction, e.g. memory
+//! - instructions(): a core retired n instructions, e.g. cycle_keeper
+//! - quantum_sync(): a core synchronized with the kernel
+//------------------------------------------------------------------------------
+class speed_counters
+{
+public:
+
+    //! The counters of the simulation.
+    static speed_counters& instance()
+    {
+        static speed_counters the_counters;
+        return the_counters;
+    }
+
+    //! Counts a transaction and publishes the simulated time.
+    void transaction()
+    {
+        n_transactions.fetch_add(1, std::memory_order_relaxed);
+        publish();
+    }
+
+    //! Counts n retired instructions.
+    void instructions(sc_dt::uint64 n)
+    {
+        n_instructions.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    //! Counts a quantum sync and publishes the simulated time.
+    void quantum_sync()
+    {
+        n_syncs.fetch_add(1, std::memory_order_relaxed);
+        publish();
+    }
+
+    //! Publishes the simulated time, call from a SystemC process.
+    void publish()
+    {
+        sim_time.store(sc_core::sc_time_stamp().value(), std::memory_order_relaxed);
+    }
+
+    //! The published simulated time in units of the time resolution.
+    std::atomic<sc_dt::uint64> sim_time;
+
+    //! The counts.
+    std::atomic<sc_dt::uint64> n_transactions, n_instructions, n_syncs;
+
+private:
+
+    speed_counters() : sim_time(0), n_transactions(0), n_instructions(0), n_syncs(0) {}
+};
+
+
+//------------------------------------------------------------------------------
+//! Counts into speed_counters if SPEED_MONITOR is defined, e.g.
+//! SPEED_COUNT(transaction()).
+//------------------------------------------------------------------------------
+#ifdef SPEED_MONITOR
+
+#define SPEED_COUNT(call) speed_counters::instance().call
+
+#else
+
+#define SPEED_COUNT(call) ((void)0)
+
+#endif
+
+
+//------------------------------------------------------------------------------
+//! Reports the simulation speed while the simulation runs.
+//
+//! A host thread wakes up every interval of wall-clock time, reads
+//! speed_counters and writes one line: the simulated time, the ratio of
+//! simulated to host time, and the transactions, instructions and quantum
+//! syncs per host second over the interval. The thread does not interact with
+//! the SystemC scheduler, so the simulation runs exactly as without it.
+//------------------------------------------------------------------------------
+class speed_monitor
+{
+public:
+
+    speed_monitor();
+    ~speed_monitor();
+
+    //! Starts reporting every interval seconds to out, stderr by default.
+    void start(double interval, FILE* out = stderr);
+
+    //! Stops reporting, writes a last line since the last report.
+    void stop();
+
+private:
+
+    //! The reporting thread.
+    void run();
+
+    //! Writes one line over the host time dt in seconds.
+    void report(double t_host, double dt);
+
+    //! The reporting thread.
+    std::thread thread;
+
+    //! Wakes the thread up to stop it.
+    std::mutex              lock;
+    std::condition_variable wake;
+    bool                    stopping;
+
+    //! Reporting interval in seconds and output.
+    double interval;
+    FILE*  out;
+
+    //! Seconds per unit of the time resolution.
+    double resolution;
+
+    //! Counts of the last report.
+    sc_dt::uint64 last_time, last_transactions, last_instructions, last_syncs;
+};
+
+#endif
@@ -0,0 +1,135 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/txn_extensions.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Transaction tags carried as generic payload extensions
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_txn_extensions_h_
+#define _tlm_demo2_txn_extensions_h_
+
+#include "systemc"
+#include "tlm.h"
+
+
+//------------------------------------------------------------------------------
+//! Base of the transaction tag extensions.
+//
+//! Each tag is its own extension type, so its slot in the payload is
+//! T::ID, fixed when the program starts. payload.get_extension<T>() is an
+//! index into the extension array of the payload, without any search.
+//------------------------------------------------------------------------------
+template <class T>
+class txn_tag : public tlm::tlm_extension<T>
+{
+public:
+
+    tlm::tlm_extension_base* clone() const
+    {
+        return new T(static_cast<const T&>(*this));
+    }
+
+    void copy_from(const tlm::tlm_extension_base& ext)
+    {
+        static_cast<T&>(*this) = static_cast<const T&>(ext);
+    }
+};
+
+//! Unique number of the transaction, counted over all initiators.
+struct txn_id : public txn_tag<txn_id>
+{
+    txn_id() : id(0) {}
+    sc_dt::uint64  id;
+};
+
+//! Issue time of the transaction, SystemC time plus the local time offset.
+struct txn_timestamp : public txn_tag<txn_timestamp>
+{
+    sc_core::sc_time  issue;
+};
+
+//! Module issuing the transaction.
+struct txn_initiator : public txn_tag<txn_initiator>
+{
+    txn_initiator() : initiator(0) {}
+    const sc_core::sc_object*  initiator;
+};
+
+//! Quality of service class of the transaction, 0 is the lowest.
+struct txn_qos : public txn_tag<txn_qos>
+{
+    txn_qos() : qos(0) {}
+    uint8_t  qos;
+};
+
+
+//------------------------------------------------------------------------------
+//! The tags attached to one payload.
+//
+//! The initiator keeps these pointers and writes the tags directly, so
+//! tagging a transaction costs a few stores. Interconnect, targets and tracing
+//! read them from the payload with get_extension<T>().
+//------------------------------------------------------------------------------
+struct txn_tags
+{
+    txn_id*         id;
+    txn_timestamp*  time;
+    txn_initiator*  initiator;
+    txn_qos*        qos;
+};
+
+
+//------------------------------------------------------------------------------
+//! Attaches the transaction tags to a payload, once.
+//
+//! Call it when the payload is created, e.g. in the constructor of the
+//! initiator owning it. The tags stay attached while the payload is reused
+//! and are deleted with it, so no transaction allocates.
+//
+//! @param trans      The payload
+//! @param initiator  The initiator owning the payload
+//! @param qos        Its quality of service class
+//
+//! @return The attached tags
+//------------------------------------------------------------------------------
+inline txn_tags txn_attach(tlm::tlm_generic_payload& trans,
+                           const sc_core::sc_object* initiator,
+                           uint8_t qos = 0)
+{
+    txn_tags t;
+    t.id        = new txn_id;
+    t.time      = new txn_timestamp;
+    t.initiator = new txn_initiator;
+    t.qos       = new txn_qos;
+
+    t.initiator->initiator = initiator;
+    t.qos->qos             = qos;
+
+    trans.set_extension(t.id);
+    trans.set_extension(t.time);
+    trans.set_extension(t.initiator);
+    trans.set_extension(t.qos);
+    return t;
+}
+
+
+//------------------------------------------------------------------------------
+//! Tags the next transaction of a payload with a new number and its issue time.
+//
+//! @param t      The tags of the payload
+//! @param delay  The local time offset of the initiator
+//------------------------------------------------------------------------------
+inline void txn_stamp(const txn_tags& t, const sc_core::sc_time& delay)
+{
+    static sc_dt::uint64 next_id = 0;
+
+    t.id->id      = next_id++;
+    t.time->issue = sc_core::sc_time_stamp() + delay;
+}
+
+#endif
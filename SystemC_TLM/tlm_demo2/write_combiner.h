@@ -0,0 +1,239 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/SystemC_TLM/demo2/write_combiner.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Write-combining buffer of the processor bus interface
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo2_write_combiner_h_
+#define _tlm_demo2_write_combiner_h_
+
+#include <cstring>
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+#include "sg_extension.h"
+
+
+//------------------------------------------------------------------------------
+//! Write-combining buffer for one line.
+//
+//! Writes into the buffered line are merged: the enabled bytes are copied into
+//! the line, a later write to the same byte replaces it. The line is written
+//! out as one scatter-gather burst, a segment per 32-bit word holding enabled
+//! bytes, each with its byte enables, see burst(). The bytes of the disabled
+//! lanes are zero, as the memory expects for a masked write.
+//
+//! The buffer only holds the data, the processor decides when to flush, see
+//! processor::combine_access(): on a write to another line, on a read
+//! overlapping the line, on a fence, when the first buffered write is older
+//! than the timeout, at a quantum sync and at the end of the program.
+//
+//! burst() moves the line into the segments of the burst and empties the
+//! buffer, so new writes can be merged while the burst is in flight.
+//------------------------------------------------------------------------------
+class write_combiner
+{
+public:
+
+    //! Reasons of a flush.
+    enum flush_e { FLUSH_LINE, FLUSH_READ, FLUSH_FENCE, FLUSH_TIMEOUT, FLUSH_SYNC,
+                   FLUSH_END, N_FLUSH };
+
+    write_combiner()
+    : timeout(sc_core::SC_ZERO_TIME), line_size(0), base(0), n_bytes(0),
+      n_writes(0), n_bursts(0), n_failed(0)
+    {
+        for (int i = 0; i < N_FLUSH; i++) n_flush[i] = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Sets the line size, zero disables the buffer. Drops buffered data.
+    //
+    //! @param bytes  Line size, a power of two of at least 4 bytes
+    //
+    //! @return  False if the size is not valid, the buffer is disabled then
+    //--------------------------------------------------------------------------
+    bool set_line(unsigned int bytes)
+    {
+        bool valid = bytes == 0 || (bytes >= 4 && (bytes & (bytes - 1)) == 0);
+        line_size = valid ? bytes : 0;
+        data.assign(line_size, 0);
+        enable.assign(line_size, 0);
+        out_data.assign(line_size, 0);
+        out_enable.assign(line_size, 0);
+        n_bytes = 0;
+        return valid;
+    }
+
+    //! True if the buffer is enabled.
+    bool enabled() const { return line_size != 0; }
+
+    //! True if writes are buffered.
+    bool pending() const { return n_bytes != 0; }
+
+    //! True if the first buffered write is older than the timeout at time now.
+    bool expired(const sc_core::sc_time& now) const
+    {
+        return pending() && timeout != sc_core::SC_ZERO_TIME && now >= t_first + timeout;
+    }
+
+    //! Time at which the buffered line expires, valid if pending().
+    sc_core::sc_time deadline() const { return t_first + timeout; }
+
+    //! True if the bytes addr ... addr + len - 1 overlap the buffered line.
+    bool overlaps(sc_dt::uint64 addr, unsigned int len) const
+    {
+        return pending() && addr < base + line_size && addr + len > base;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Merges a write into the buffer.
+    //
+    //! @param addr     The address of the write
+    //! @param len      The data length
+    //! @param data     The data
+    //! @param byte_en  Byte enables of len bytes, 0xFF or 0x00 each, or 0
+    //! @param now      The time of the write, SystemC time plus local offset
+    //
+    //! @return  False if the enabled bytes are not in the buffered line, or
+    //!          span two lines. The buffer is unchanged then.
+    //--------------------------------------------------------------------------
+    bool add(sc_dt::uint64 addr, unsigned int len, const uint8_t* data,
+             const uint8_t* byte_en, const sc_core::sc_time& now)
+    {
+        if (!enabled()) return false;
+
+        // line of the first enabled byte, all enabled bytes must be in it
+        sc_dt::uint64 line = 0;
+        bool          any  = false;
+        for (unsigned int i = 0; i < len; i++)
+        {
+            if (byte_en != 0 && byte_en[i] == 0) continue;
+            sc_dt::uint64 l = (addr + i) & ~sc_dt::uint64(line_size - 1);
+            if (!any) line = l;
+            else if (l != line) return false;
+            any = true;
+        }
+        if (!any) return true;  // nothing enabled, nothing to write
+        if (pending() && line != base) return false;
+
+        if (!pending())
+        {
+            base    = line;
+            t_first = now;
+        }
+        for (unsigned int i = 0; i < len; i++)
+        {
+            if (byte_en != 0 && byte_en[i] == 0) continue;
+            unsigned int o = unsigned(addr + i - base);
+            if (enable[o] == 0) n_bytes++;
+            this->data[o] = data[i];
+            enable[o]     = 0xFF;
+        }
+        n_writes++;
+        return true;
+    }
+
+    //--------------------------------------------------------------------------
+    //! Moves the buffered line into a burst, valid until the next burst().
+    //
+    //! @param reason  Why the line is flushed, for the statistics
+    //--------------------------------------------------------------------------
+    sg_extension& burst(flush_e reason)
+    {
+        data.swap(out_data);
+        enable.swap(out_enable);
+        std::memset(&data[0], 0, line_size);
+        std::memset(&enable[0], 0, line_size);
+        n_bytes = 0;
+
+        sg.command = tlm::TLM_WRITE_COMMAND;
+        sg.clear();
+        for (unsigned int w = 0; w < line_size; w += 4)
+        {
+            if (out_enable[w] | out_enable[w + 1] | out_enable[w + 2] | out_enable[w + 3])
+            {
+                sg.add(base + w, 4, &out_data[w], &out_enable[w]);
+            }
+        }
+        n_bursts++;
+        n_flush[reason]++;
+        return sg;
+    }
+
+    //! Counts a burst answered with an error.
+    void failed() { n_failed++; }
+
+    //--------------------------------------------------------------------------
+    //! Visits the runs of enabled bytes of the buffered line and empties it.
+    //
+    //! @param f  Called as f(addr, data, len) per run
+    //--------------------------------------------------------------------------
+    template <class F>
+    void drain(F f)
+    {
+        for (unsigned int i = 0; i < line_size; )
+        {
+            if (enable[i] == 0) { i++; continue; }
+            unsigned int j = i;
+            while (j < line_size && enable[j] != 0) j++;
+            f(base + i, &data[i], j - i);
+            i = j;
+        }
+        std::memset(&data[0], 0, line_size);
+        std::memset(&enable[0], 0, line_size);
+        n_bytes = 0;
+    }
+
+    //! Flush after the first buffered write is this old, zero for never.
+    sc_core::sc_time timeout;
+
+    //! Writes merged into the buffer.
+    sc_dt::uint64 get_writes() const { return n_writes; }
+
+    //! Bursts issued.
+    sc_dt::uint64 get_bursts() const { return n_bursts; }
+
+    //! Bursts answered with an error, the writes were posted.
+    sc_dt::uint64 get_failed_bursts() const { return n_failed; }
+
+    //! Bursts issued for one reason.
+    sc_dt::uint64 get_flushes(flush_e reason) const { return n_flush[reason]; }
+
+    //! Merged writes per burst.
+    double get_merge_ratio() const { return n_bursts ? double(n_writes) / n_bursts : 0; }
+
+private:
+
+    //! Line size in bytes, zero if disabled.
+    unsigned int line_size;
+
+    //! Address of the buffered line.
+    sc_dt::uint64 base;
+
+    //! Buffered bytes and their enables.
+    std::vector<uint8_t> data, enable;
+
+    //! Bytes and enables of the burst in flight.
+    std::vector<uint8_t> out_data, out_enable;
+
+    //! Number of enabled bytes.
+    unsigned int n_bytes;
+
+    //! Time of the first buffered write.
+    sc_core::sc_time t_first;
+
+    //! The burst, reused.
+    sg_extension sg;
+
+    //! Statistics.
+    sc_dt::uint64 n_writes, n_bursts, n_failed, n_flush[N_FLUSH];
+};
+
+#endif
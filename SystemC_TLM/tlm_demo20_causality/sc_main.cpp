@@ -0,0 +1,86 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo20_causality/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo20 (causality of decoupled accesses)
+ *
+ * Usage: tlm_demo20_causality [quantum ns] [off|flag|sync] [granularity bytes]
+ *                             [simulated time ns]
+ *
+ * The producer and consumer of TLM_demo3 (decop) share the memory. With a
+ * large quantum the consumer reads data the producer writes in its past or
+ * future. The memory is declared as a shared region: the reads from the past
+ * of a write are counted, and with sync the consumer is synchronized up to
+ * the write before it reads.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_decop/processor0.h"
+#include "../tlm_demo3_decop/processor1.h"
+#include "../tlm_demo3_sync/bus.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo20
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    double  quantum     = (argc > 1) ? atof(argv[1]) : 200;
+    string  policy      = (argc > 2) ? argv[2] : "sync";
+    int     granularity = (argc > 3) ? atoi(argv[3]) : 4;
+    double  t_sim       = (argc > 4) ? atof(argv[4]) : 1000;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(quantum, sc_core::SC_NS ));
+    
+    //! Instantiate the modules
+    processor0   *i_cpu0 = new processor0("i_cpu0");
+    processor1   *i_cpu1 = new processor1("i_cpu1");
+    memory       *i_mem  = new memory("i_memory", false);
+    bus          *i_bus  = new bus("i_bus");
+    
+    //! Bind  the TLM ports
+    i_cpu0->data_bus.bind( i_bus->data_bus0 );
+    i_cpu1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    //! The whole memory array is shared by the cores
+    if (policy != "off")
+    {
+        i_mem->causality.declare(0, 256, granularity);
+        i_mem->causality.policy = (policy == "flag") ? causality_tracker::FLAG :
+                                                       causality_tracker::SYNC;
+    }
+    
+    int t_start=clock();
+    sc_core::sc_start(t_sim, sc_core::SC_NS);
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 20 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Quantum          : " << setw(10) << setfill(' ') << quantum   <<" ns          #"<<endl;
+    cout << "# Reads from past  : " << setw(10) << setfill(' ') << dec << i_mem->causality.get_violations()  <<"             #"<<endl;
+    cout << "# Forced syncs     : " << setw(10) << setfill(' ') << i_mem->causality.get_syncs()       <<"             #"<<endl;
+    cout << "# Stale reads      : " << setw(10) << setfill(' ') << i_mem->causality.get_stale_reads() <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
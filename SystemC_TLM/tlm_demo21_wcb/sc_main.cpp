@@ -0,0 +1,102 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo21_wcb/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo21 (write-combining buffer)
+ *
+ * Usage: tlm_demo21_wcb [line bytes] [quantum ns] [timeout ns]
+ *                       [simulated time ns]
+ *
+ * The producer of TLM_demo3 (decop) writes one byte per transaction to
+ * consecutive addresses. With a line size the writes are merged in its
+ * write-combining buffer and issued as one burst per line, zero disables the
+ * buffer. A line is also flushed at each quantum sync and after the timeout,
+ * the line size must be a power of two of at least 4 bytes. The writes still
+ * buffered when the simulated time is over are drained into the memory.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/speed_monitor.h"
+#include "../tlm_demo3_decop/processor0.h"
+#include "../tlm_demo3_decop/processor1.h"
+#include "../tlm_demo3_sync/bus.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo21
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    long         line    = (argc > 1) ? atol(argv[1]) : 32;
+    double       quantum = (argc > 2) ? atof(argv[2]) : 2000;
+    double       timeout = (argc > 3) ? atof(argv[3]) : 100;
+    double       t_sim   = (argc > 4) ? atof(argv[4]) : 100000;
+    
+    if (line < 0 || line > 4096 || (line != 0 && (line < 4 || (line & (line - 1)) != 0)) ||
+        quantum <= 0 || timeout < 0 || t_sim <= 0)
+    {
+        cerr << "Usage: " << argv[0] << " [line bytes] [quantum ns] [timeout ns]"
+             << " [simulated time ns]" << endl;
+        cerr << "The line size is 0 or a power of two from 4 to 4096 bytes" << endl;
+        return 1;
+    }
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(quantum, sc_core::SC_NS ));
+    
+    //! Instantiate the modules
+    processor0   *i_cpu0 = new processor0("i_cpu0");
+    processor1   *i_cpu1 = new processor1("i_cpu1");
+    memory       *i_mem  = new memory("i_memory", false);
+    bus          *i_bus  = new bus("i_bus");
+    
+    //! Bind  the TLM ports
+    i_cpu0->data_bus.bind( i_bus->data_bus0 );
+    i_cpu1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    //! The producer merges its byte writes
+    i_cpu0->set_write_combining(line, sc_core::sc_time(timeout, sc_core::SC_NS));
+    
+    int t_start=clock();
+    sc_core::sc_start(t_sim, sc_core::SC_NS);
+    int t_stop=clock();
+    
+    // the producer still runs, its buffered writes are not lost
+    i_cpu0->drain_writes();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    const write_combiner& wc = i_cpu0->get_write_combiner();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 21 : Simulation Complete.        #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Line size        : " << setw(10) << setfill(' ') << dec << line <<" bytes       #"<<endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << speed_counters::instance().n_transactions.load() <<"             #"<<endl;
+    cout << "# Merged writes    : " << setw(10) << setfill(' ') << wc.get_writes() <<"             #"<<endl;
+    cout << "# Bursts           : " << setw(10) << setfill(' ') << wc.get_bursts() <<"             #"<<endl;
+    cout << "#  - line change   : " << setw(10) << setfill(' ') << wc.get_flushes(write_combiner::FLUSH_LINE)    <<"             #"<<endl;
+    cout << "#  - quantum sync  : " << setw(10) << setfill(' ') << wc.get_flushes(write_combiner::FLUSH_SYNC)    <<"             #"<<endl;
+    cout << "#  - timeout       : " << setw(10) << setfill(' ') << wc.get_flushes(write_combiner::FLUSH_TIMEOUT) <<"             #"<<endl;
+    cout << "#  - program end   : " << setw(10) << setfill(' ') << wc.get_flushes(write_combiner::FLUSH_END)     <<"             #"<<endl;
+    cout << "# Merge ratio      : " << setw(10) << setfill(' ') << wc.get_merge_ratio() <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,187 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo3_decop/cycle_keeper.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Cycle based quantum keeper definition and implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo3_decop_cycle_keeper_h_
+#define _tlm_demo3_decop_cycle_keeper_h_
+
+#include <systemc>
+#include "tlm.h"
+#include "../tlm_demo2/sim_mode.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo2/speed_monitor.h"
+
+// ----------------------------------------------------------------------------
+//! Quantum keeper counting the local time offset in clock cycles.
+//
+//! The local time is kept as a number of core clock cycles plus a time offset,
+//! which is only set by the delay annotated on a transaction. When the local
+//! time changes, the number of cycles left until the end of the current global
+//! quantum is precomputed. Accounting one instruction is then a single integer
+//! add in ::inc() and a single compare in ::need_sync(). The conversion to
+//! sc_time only takes place to annotate a transaction or to synchronize.
+//
+//! Unlike tlm_utils::tlm_quantumkeeper the methods are not virtual, so that
+//! they can be inlined into the instruction loop.
+//
+//! The simulation mode (see sim_mode) is latched on every reset, i.e. at each
+//! quantum sync. In FUNCTIONAL mode ::inc() counts instructions instead of
+//! cycles, the budget is the number of instructions per quantum, the local
+//! time offset is always zero and ::sync() waits until the next quantum. The
+//! instruction loop itself does not change.
+//
+//! The cycles are counted as retired instructions in speed_counters when the
+//! local time is set or synchronized, not per instruction, see SPEED_COUNT.
+// ----------------------------------------------------------------------------
+class cycle_keeper
+{
+public:
+    
+    // -------------------------------------------------------------------------
+    //! Class constructor, default core frequency of 500 MHz.
+    // -------------------------------------------------------------------------
+    cycle_keeper()
+    : period(2, sc_core::SC_NS), offset(sc_core::SC_ZERO_TIME),
+      cycles(0), budget(0), functional(false)
+    {
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Sets the core clock frequency and resets the local time.
+    //
+    //! @param freq  Core clock frequency in Hz
+    // -------------------------------------------------------------------------
+    void set_frequency(double freq)
+    {
+        period = sc_core::sc_time(1.0 / freq, sc_core::SC_SEC);
+        reset();
+    }
+    
+    //! Duration of one clock cycle.
+    const sc_core::sc_time& get_period() const { return period; }
+    
+    //! Advances the local time by n clock cycles.
+    void inc(uint64_t n = 1) { cycles += n; }
+    
+    //! True if the local time reached the end of the global quantum.
+    bool need_sync() const { return cycles >= budget; }
+    
+    //! Local time offset in clock cycles, excluding the annotated offset.
+    uint64_t get_local_cycles() const { return cycles; }
+    
+    // -------------------------------------------------------------------------
+    //! Local time offset to annotate a transaction.
+    // -------------------------------------------------------------------------
+    sc_core::sc_time get_local_time() const
+    {
+        if (functional) return sc_core::SC_ZERO_TIME;
+        return offset + period * double(cycles);
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Local time offset plus the current simulation time.
+    // -------------------------------------------------------------------------
+    sc_core::sc_time get_current_time() const
+    {
+        return sc_core::sc_time_stamp() + get_local_time();
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Sets the local time offset to the delay returned by a transaction.
+    //
+    //! @param t  The new local time offset
+    // -------------------------------------------------------------------------
+    void set(const sc_core::sc_time& t)
+    {
+        if (functional) return; // keep counting towards the next quantum
+        SPEED_COUNT(instructions(cycles));
+        offset = t;
+        cycles = 0;
+        compute_budget();
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Synchronizes the local time with the SystemC kernel.
+    // -------------------------------------------------------------------------
+    void sync()
+    {
+        SPEED_COUNT(instructions(cycles));
+        if (functional)
+        {
+            sc_core::sc_time quantum =
+                tlm::tlm_global_quantum::instance().compute_local_quantum();
+            if (quantum == sc_core::SC_ZERO_TIME) quantum = period * double(cycles);
+            PROF_WAIT(quantum);
+        }
+        else
+        {
+            PROF_WAIT(get_local_time());
+        }
+        SPEED_COUNT(quantum_sync());
+        reset();
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Resets the local time offset to zero.
+    // -------------------------------------------------------------------------
+    void reset()
+    {
+        functional = !sim_mode::instance().is_timed();
+        offset = sc_core::SC_ZERO_TIME;
+        cycles = 0;
+        compute_budget();
+    }
+    
+private:
+    
+    // -------------------------------------------------------------------------
+    //! Computes the number of cycles from the local time offset to the end of
+    //! the global quantum, rounded up.
+    // -------------------------------------------------------------------------
+    void compute_budget()
+    {
+        if (functional)
+        {
+            budget = sim_mode::instance().get_functional_instructions();
+            return;
+        }
+        
+        sc_core::sc_time quantum =
+            tlm::tlm_global_quantum::instance().compute_local_quantum();
+        
+        if (quantum == sc_core::SC_ZERO_TIME || offset >= quantum)
+        {
+            budget = 0; // no quantum or already beyond, sync on next check
+            return;
+        }
+        
+        sc_core::sc_time left = quantum - offset;
+        budget = (uint64_t) (left / period);
+        if (period * double(budget) < left) budget++;
+    }
+    
+    //! Duration of one clock cycle.
+    sc_core::sc_time period;
+    
+    //! Local time offset annotated by transactions.
+    sc_core::sc_time offset;
+    
+    //! Local time offset in clock cycles on top of ::offset.
+    uint64_t cycles;
+    
+    //! Number of cycles until the end of the global quantum.
+    uint64_t budget;
+    
+    //! True if the keeper runs in FUNCTIONAL mode until the next reset.
+    bool functional;
+};
+
+#endif
@@ -22,12 +22,14 @@ using namespace sc_core;
 //! Class Constructor of the processor0 module
 //
 //! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
 //------------------------------------------------------------------------------
-processor0::processor0(sc_module_name  name) : processor (name)
+processor0::processor0(sc_module_name  name, bool verbose) :
+processor (name),
+verbose (verbose)
 {
-    g_quantum = &(tlm::tlm_global_quantum::instance());
-    q_keeper.set_global_quantum( g_quantum->get() );
-    q_keeper.reset();    // Zero local time offset
+    c_keeper.set_frequency(500e6); // 500 MHz, 2 ns per instruction
+    c_keeper.reset();    // Zero local time offset
 }
 
 
@@ -48,8 +50,21 @@ int processor0::bus_readwrite(tlm::tlm_command  cmd,
                              uint8_t*          data_ptr,
                              uint8_t*          byte_en_ptr)
 {
-    // Initialize 8 out of the 10 attributes,
-    // byte_enable_length and extensions being unused
+    PROF_SCOPE("processor::bus_readwrite");
+    
+    //  time delay
+    sc_core::sc_time  delay = c_keeper.get_local_time();
+    
+    // a buffered write completes without a transaction
+    if (combine_access(cmd, addr, data_len, data_ptr, byte_en_ptr, delay))
+    {
+        c_keeper.set( delay );
+        if( c_keeper.need_sync() ) { quantum_sync(); } // Sync if needed
+        return 0;
+    }
+    
+    // Initialize 8 out of the 10 attributes, byte_enable_length being unused,
+    // the extensions are the transaction tags
     trans.set_command(cmd);
     trans.set_address(addr);
     trans.set_data_ptr(data_ptr);
@@ -59,15 +74,14 @@ int processor0::bus_readwrite(tlm::tlm_command  cmd,
     trans.set_dmi_allowed(false);
     trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
     
-    //  time delay
-    sc_core::sc_time  delay = q_keeper.get_local_time();
+    txn_stamp(tags, delay);
     
     // Blocking transport call
     data_bus->b_transport(trans, delay);
     
     // use td instead of wait to update local time
-    q_keeper.set( delay );
-    if( q_keeper.need_sync() ) { q_keeper.sync(); } // Sync if needed
+    c_keeper.set( delay );
+    if( c_keeper.need_sync() ) { quantum_sync(); } // Sync if needed
     
     
     // For now just simple non-zero return code on error
@@ -76,6 +90,24 @@ int processor0::bus_readwrite(tlm::tlm_command  cmd,
 
 
 
+// ----------------------------------------------------------------------------
+//! Synchronizes the local time with the SystemC kernel. The writes in the
+//! write-combining buffer are issued in the local time before, so other
+//! initiators see them after the sync.
+// ----------------------------------------------------------------------------
+void processor0::quantum_sync()
+{
+    if (wc.pending())
+    {
+        sc_core::sc_time delay = c_keeper.get_local_time();
+        flush_writes(write_combiner::FLUSH_SYNC, delay);
+        c_keeper.set( delay );
+    }
+    c_keeper.sync();
+}
+
+
+
 // -----------------------------------------------------------------------------
 //! The SystemC thread running the TLM access tests of the example.
 //
@@ -98,9 +130,11 @@ void processor0::program_main()
                           reinterpret_cast<uint8_t *>(&wdata),
                           reinterpret_cast<uint8_t *>(&byte_en))
            ){
-            cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Succeeded.\n";
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Succeeded.\n";
         }else{
-            cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
         }
     }
 }
@@ -119,18 +153,24 @@ void processor0::program_main()
     
     for (uint32_t pc = 0x00000100; pc<0x00000128; pc+=4)
     {
-        // debug print to track the program counter
-        cout << "     (cpu0) @ " << sc_time_stamp();
-        cout << ", prepareing write data, PC = 0x";
-        cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        if (verbose)
+        {
+            // debug print to track the program counter
+            cout << "     (cpu0) @ " << sc_time_stamp();
+            cout << ", prepareing write data, PC = 0x";
+            cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        }
         
-        // wait for the instruction delay
-        q_keeper.inc(sc_time(2, SC_NS));
-        if( q_keeper.need_sync() ) q_keeper.sync(); // Sync if needed
+        // wait for the instruction delay of one cycle
+        c_keeper.inc();
+        if( c_keeper.need_sync() ) quantum_sync(); // Sync if needed
         
     }
-    cout << "     (cpu0) @ " << sc_time_stamp();
-    cout << ", data prepared, start writing to memory. \n"  << endl;
+    if (verbose)
+    {
+        cout << "     (cpu0) @ " << sc_time_stamp();
+        cout << ", data prepared, start writing to memory. \n"  << endl;
+    }
     
     return data++;
 }
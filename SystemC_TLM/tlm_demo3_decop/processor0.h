@@ -14,7 +14,7 @@
 #define _tlm_demo3_decop_processor0_h_
 
 #include "../tlm_demo2/processor.h"
-#include "tlm_utils/tlm_quantumkeeper.h"
+#include "cycle_keeper.h"
 
 
 //------------------------------------------------------------------------------
@@ -25,7 +25,7 @@ class processor0 : public  processor
 public:
     
     //! Class Construct
-    processor0(sc_core::sc_module_name  name);
+    processor0(sc_core::sc_module_name  name, bool verbose = true);
     
     
 private:
@@ -43,11 +43,14 @@ private:
                               uint8_t*             data_ptr,
                               uint8_t*             byte_en_ptr);
     
-    //global quantum.
-    tlm::tlm_global_quantum *g_quantum;
+    //! Synchronizes with the kernel, the buffered writes are issued first.
+    void quantum_sync();
     
-    // Quantum keeper for the ISS model thread.
-    tlm_utils::tlm_quantumkeeper  q_keeper;
+    // Cycle based quantum keeper for the ISS model thread.
+    cycle_keeper  c_keeper;
+    
+    //! Print the program trace on the console.
+    bool verbose;
 };
 
 #endif
@@ -21,12 +21,14 @@ using namespace sc_core;
 //! Class Constructor of the processor0 module
 //
 //! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
 //------------------------------------------------------------------------------
-processor1::processor1(sc_core::sc_module_name  name) : processor (name)
+processor1::processor1(sc_core::sc_module_name  name, bool verbose) :
+processor (name),
+verbose (verbose)
 {
-    g_quantum = &(tlm::tlm_global_quantum::instance());
-    q_keeper.set_global_quantum( g_quantum->get() );
-    q_keeper.reset();    // Zero local time offset
+    c_keeper.set_frequency(500e6); // 500 MHz, 2 ns per instruction
+    c_keeper.reset();    // Zero local time offset
 }
 
 
@@ -47,8 +49,10 @@ int processor1::bus_readwrite(tlm::tlm_command  cmd,
                               uint8_t*          data_ptr,
                               uint8_t*          byte_en_ptr)
 {
-    // Initialize 8 out of the 10 attributes,
-    // byte_enable_length and extensions being unused
+    PROF_SCOPE("processor::bus_readwrite");
+    
+    // Initialize 8 out of the 10 attributes, byte_enable_length being unused,
+    // the extensions are the transaction tags
     trans.set_command(cmd);
     trans.set_address(addr);
     trans.set_data_ptr(data_ptr);
@@ -59,14 +63,15 @@ int processor1::bus_readwrite(tlm::tlm_command  cmd,
     trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
     
     //  time delay
-    sc_core::sc_time  delay = q_keeper.get_local_time();
+    sc_core::sc_time  delay = c_keeper.get_local_time();
+    txn_stamp(tags, delay);
     
     // Blocking transport call
     data_bus->b_transport(trans, delay);
     
     // use td instead of wait to update local time
-    q_keeper.set( delay );
-    if( q_keeper.need_sync() ) { q_keeper.sync(); } // Sync if needed
+    c_keeper.set( delay );
+    if( c_keeper.need_sync() ) { c_keeper.sync(); } // Sync if needed
     
     
     // For now just simple non-zero return code on error
@@ -102,10 +107,12 @@ void processor1::program_main()
                           reinterpret_cast<uint8_t *>(&rdata),
                           reinterpret_cast<uint8_t *>(&byte_en))
            ){
-            cout << "     (cpu0) @ " << sc_time_stamp() << ", Read Succeeded.\n";
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Read Succeeded.\n";
             process_data (rdata);
         }else{
-            cout << "     (cpu0) @ " << sc_time_stamp() << ", Read Failed.\n";
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Read Failed.\n";
         }
     }
 }
@@ -119,24 +126,33 @@ void processor1::program_main()
 // -----------------------------------------------------------------------------
 void processor1::process_data (uint32_t data)
 {
-    cout << "(cpu1)      @ " << sc_time_stamp();
-    cout << ", data received = 0x";
-    cout <<  setw(2) << setfill('0') << hex << uppercase << data << endl;
+    if (verbose)
+    {
+        cout << "(cpu1)      @ " << sc_time_stamp();
+        cout << ", data received = 0x";
+        cout <<  setw(2) << setfill('0') << hex << uppercase << data << endl;
+    }
     
     for (uint32_t pc = 0x00000200; pc<0x00000228; pc+=4)
     {
-        // debug print to track the program counter
-        cout << "(cpu1)      @ " << sc_time_stamp();
-        cout << ", processing received data, PC = 0x";
-        cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        if (verbose)
+        {
+            // debug print to track the program counter
+            cout << "(cpu1)      @ " << sc_time_stamp();
+            cout << ", processing received data, PC = 0x";
+            cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        }
         
-        // wait for the instruction delay
-        q_keeper.inc(sc_time(2, SC_NS));
-        if( q_keeper.need_sync() ) q_keeper.sync(); // Sync if needed
+        // wait for the instruction delay of one cycle
+        c_keeper.inc();
+        if( c_keeper.need_sync() ) c_keeper.sync(); // Sync if needed
     }
     
-    cout << "(cpu1)      @ " << sc_time_stamp();
-    cout << ", data processing complete.\n" << endl;
+    if (verbose)
+    {
+        cout << "(cpu1)      @ " << sc_time_stamp();
+        cout << ", data processing complete.\n" << endl;
+    }
     
     return;
 }
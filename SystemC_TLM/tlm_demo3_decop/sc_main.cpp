@@ -5,6 +5,9 @@
  *
  * @brief   Main program of TLM_demo3 (temporal decoupling version)
  *
+ * Usage: tlm_demo3_decop [simulated time ns] [monitor interval s] [monitor file]
+ *                        [fast-forward time ns]
+ *
  * This file is part of TLM tutorials in the master course "Virtual Prototyping"
  * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
  * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
@@ -13,6 +16,7 @@
 
 #include <time.h>
 #include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/speed_monitor.h"
 #include "processor0.h"
 #include "processor1.h"
 #include "../tlm_demo3_sync/bus.h"
@@ -40,12 +44,41 @@ int sc_main(int argc, char* argv[])
     i_cpu1->data_bus.bind( i_bus->data_bus1 );
     i_bus->initiator_socket.bind(i_mem->data_bus);
     
-    double  t_sim = 100;  // simulation time in nano second
+    double  t_sim    = (argc > 1) ? atof(argv[1]) : 100; // timed simulation time in nano second
+    double  interval = (argc > 2) ? atof(argv[2]) : 0;   // speed reports, 0 for none
+    bool    to_file  = (argc > 3) && (string(argv[3]) != "-");
+    FILE*   log      = to_file ? fopen(argv[3], "w") : stderr;
+    double  t_ff     = (argc > 4) ? atof(argv[4]) : 0;   // functional fast-forward time in nano second, 0 for none
+    if (!log)
+    {
+        cerr << "Can not open " << argv[3] << endl;
+        return 1;
+    }
+    
+    // report the simulation speed while running, over both phases
+    speed_monitor monitor;
+    if (interval > 0) monitor.start(interval, log);
+    
+    // optionally fast-forward without timing, then simulate the region of
+    // interest timed
+    int t_ff_start=clock();
+    if (t_ff > 0)
+    {
+        sim_mode::instance().set_functional_instructions(10);
+        sim_mode::instance().set(sim_mode::FUNCTIONAL);
+        sc_start(t_ff, sc_core::SC_NS);
+        sim_mode::instance().set(sim_mode::TIMED);
+    }
+    int t_ff_stop=clock();
     
     int t_start=clock();
     sc_start(t_sim, sc_core::SC_NS);
     int t_stop=clock();
     
+    monitor.stop();
+    if (to_file) fclose(log);
+    
+    double t_cpu_ff = (t_ff_stop-t_ff_start)/double(CLOCKS_PER_SEC);
     double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
 
 
@@ -55,6 +88,11 @@ int sc_main(int argc, char* argv[])
     cout << "#                                           #" << endl;
     cout << "# TLM_demo 3(decop) : Simulation Complete.  #" << endl;
     cout << "#                                           #" << endl;
+    if (t_ff > 0)
+    {
+        cout << "# Fast-forward time: " << setw(10) << setfill(' ') << t_ff      <<" ns          #"<<endl;
+        cout << "# Fast-forward CPU : " << setw(10) << setfill(' ') << t_cpu_ff*1e9 <<" ns          #"<< endl;
+    }
     cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
     cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
     cout << "#                                           #" << endl;
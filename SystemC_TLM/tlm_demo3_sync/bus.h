@@ -18,6 +18,8 @@
 #include "tlm.h"
 #include "tlm_utils/simple_initiator_socket.h"
 #include "tlm_utils/simple_target_socket.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo2/sg_extension.h"
 
 // ----------------------------------------------------------------------------
 //! System bus module.
@@ -50,6 +52,8 @@ public:
         // Register callbacks for incoming interface method calls
         data_bus0.register_b_transport(  this, &bus::bus_read_write0);
         data_bus1.register_b_transport(  this, &bus::bus_read_write1);
+        data_bus0.register_transport_dbg(this, &bus::bus_debug);
+        data_bus1.register_transport_dbg(this, &bus::bus_debug);
     }
 
 private:
@@ -58,7 +62,9 @@ private:
     // -------------------------------------------------------------------------
     //！TLM2.0 blocking transport routine for the bus socket
     //
-    //! Receives transport requests and route the transaction on the target socket
+    //! Receives transport requests and route the transaction on the target socket.
+    //! Scatter-gather transactions are forwarded as a whole, and split into
+    //! their segments if the target does not execute them.
     //
     //! @param trans  The transaction payload
     //! @param delay  How far the initiator is beyond baseline SystemC time. For
@@ -66,15 +72,19 @@ private:
     // ----------------------------------------------------------------------------
     void bus_read_write0( tlm::tlm_generic_payload& trans, sc_core::sc_time& delay )
     {
+        PROF_SCOPE("bus::b_transport");
+        
         trans.set_response_status( tlm::TLM_OK_RESPONSE );  // Always OK
         
-        initiator_socket->b_transport( trans, delay );
+        sg_transport( initiator_socket, trans, delay );
     }
     
     // -------------------------------------------------------------------------
     //！TLM2.0 blocking transport routine for the bus socket
     //
-    //! Receives transport requests and route the transaction on the target socket
+    //! Receives transport requests and route the transaction on the target socket.
+    //! Scatter-gather transactions are forwarded as a whole, and split into
+    //! their segments if the target does not execute them.
     //
     //! @param trans  The transaction payload
     //! @param delay  How far the initiator is beyond baseline SystemC time. For
@@ -82,9 +92,25 @@ private:
     // ----------------------------------------------------------------------------
     void bus_read_write1( tlm::tlm_generic_payload& trans, sc_core::sc_time& delay )
     {
+        PROF_SCOPE("bus::b_transport");
+        
         trans.set_response_status( tlm::TLM_OK_RESPONSE );  // Always OK
         
-        initiator_socket->b_transport( trans, delay );
+        sg_transport( initiator_socket, trans, delay );
+    }
+    
+    // -------------------------------------------------------------------------
+    //！TLM2.0 debug transport routine for both bus sockets
+    //
+    //! Routes the debug transaction on the target socket, without any timing.
+    //
+    //! @param trans  The transaction payload
+    //
+    //! @return  The number of bytes transferred by the target
+    // ----------------------------------------------------------------------------
+    unsigned int bus_debug( tlm::tlm_generic_payload& trans )
+    {
+        return initiator_socket->transport_dbg( trans );
     }
     
 };
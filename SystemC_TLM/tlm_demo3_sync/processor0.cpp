@@ -12,6 +12,7 @@
 
 
 #include "processor0.h"
+#include "../tlm_demo2/speed_monitor.h"
 
 
 using namespace std;
@@ -77,6 +78,10 @@ void processor0::program_main()
         cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
         
         wait(sc_time(2, SC_NS)); // wait for the instruction delay
+        
+        // each instruction synchronizes with the kernel
+        SPEED_COUNT(instructions(1));
+        SPEED_COUNT(quantum_sync());
     }
     cout << "     (cpu0) @ " << sc_time_stamp();
     cout << ", data prepared, start writing to memory. \n"  << endl;
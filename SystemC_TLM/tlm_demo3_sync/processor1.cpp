@@ -12,6 +12,7 @@
 
 
 #include "processor1.h"
+#include "../tlm_demo2/speed_monitor.h"
 
 
 using namespace std;
@@ -84,6 +85,10 @@ void processor1::process_data (uint32_t data)
         cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
         
         wait(sc_time(2, SC_NS)); // wait for the instruction delay
+        
+        // each instruction synchronizes with the kernel
+        SPEED_COUNT(instructions(1));
+        SPEED_COUNT(quantum_sync());
     }
     
     cout << "(cpu1)      @ " << sc_time_stamp();
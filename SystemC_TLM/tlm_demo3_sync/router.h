@@ -0,0 +1,248 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo3/router.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Address decoding router module definition and implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo3_router_h_
+#define _tlm_demo3_router_h_
+
+
+#include <systemc>
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo2/sg_extension.h"
+
+// ----------------------------------------------------------------------------
+//! Interconnect with an address map, unlike ::bus which has a single target.
+//
+//! Each initiator socket serves an address range set with map(). The address
+//! is made relative to the start of the range on the way to the target and
+//! restored on the way back. Blocking, debug and DMI requests are routed, DMI
+//! regions and invalidations are translated back into router addresses.
+//! Transactions outside all ranges get an address error.
+//
+//! A scatter-gather transaction with all segments in one range is forwarded
+//! as a whole. Otherwise it is split: each segment is forwarded on its own.
+//
+//! @tparam N_INITIATORS   Number of target sockets, for the initiators
+//! @tparam N_TARGETS      Number of initiator sockets, for the targets
+// ----------------------------------------------------------------------------
+template <unsigned int N_INITIATORS, unsigned int N_TARGETS>
+class router : public sc_core::sc_module
+{
+public:
+    //! @brief The TLM target sockets to receive the initiator traffic.
+    tlm_utils::simple_target_socket_tagged<router>     target_socket[N_INITIATORS];
+
+    //! @brief The TLM initiator sockets to the targets, one per range.
+    tlm_utils::simple_initiator_socket_tagged<router>  initiator_socket[N_TARGETS];
+
+    // -------------------------------------------------------------------------
+    //! Custom Constructor for the router.
+    //
+    //! @param name             The SystemC module name
+    // -------------------------------------------------------------------------
+    router(sc_core::sc_module_name name) : sc_module(name)
+    {
+        // Register callbacks for incoming interface method calls
+        for (unsigned int i = 0; i < N_INITIATORS; i++)
+        {
+            target_socket[i].register_b_transport(this, &router::b_transport, i);
+            target_socket[i].register_transport_dbg(this, &router::transport_dbg, i);
+            target_socket[i].register_get_direct_mem_ptr(this, &router::get_direct_mem_ptr, i);
+        }
+        for (unsigned int t = 0; t < N_TARGETS; t++)
+        {
+            initiator_socket[t].register_invalidate_direct_mem_ptr(
+                this, &router::invalidate_direct_mem_ptr, t);
+            base[t] = 0;
+            size[t] = 0;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    //! Maps an address range to an initiator socket.
+    //
+    //! @param port   Index of the initiator socket
+    //! @param start  First address of the range
+    //! @param bytes  Size of the range
+    // -------------------------------------------------------------------------
+    void map(unsigned int port, sc_dt::uint64 start, sc_dt::uint64 bytes)
+    {
+        base[port] = start;
+        size[port] = bytes;
+    }
+
+private:
+
+    // -------------------------------------------------------------------------
+    //! Index of the initiator socket serving addr, N_TARGETS if none.
+    // -------------------------------------------------------------------------
+    unsigned int decode(sc_dt::uint64 addr) const
+    {
+        for (unsigned int t = 0; t < N_TARGETS; t++)
+        {
+            if (addr >= base[t] && addr - base[t] < size[t]) return t;
+        }
+        return N_TARGETS;
+    }
+
+    // -------------------------------------------------------------------------
+    //！TLM2.0 blocking transport routine for the router sockets
+    //
+    //! @param id     Index of the target socket
+    //! @param trans  The transaction payload
+    //! @param delay  How far the initiator is beyond baseline SystemC time. For
+    //!              use with temporal decoupling
+    // ----------------------------------------------------------------------------
+    void b_transport( int id, tlm::tlm_generic_payload& trans, sc_core::sc_time& delay )
+    {
+        PROF_SCOPE("router::b_transport");
+
+        sg_extension* sg = 0;
+        trans.get_extension(sg);
+        if (sg)
+        {
+            scatter_gather(trans, *sg, delay);
+            return;
+        }
+
+        sc_dt::uint64 addr = trans.get_address();
+        unsigned int  t    = decode(addr);
+        if (t == N_TARGETS)
+        {
+            trans.set_response_status( tlm::TLM_ADDRESS_ERROR_RESPONSE );
+            return;
+        }
+
+        trans.set_address(addr - base[t]);
+        initiator_socket[t]->b_transport( trans, delay );
+        trans.set_address(addr);
+    }
+
+    // -------------------------------------------------------------------------
+    //! Routes a scatter-gather transaction, as a whole if possible.
+    // -------------------------------------------------------------------------
+    void scatter_gather( tlm::tlm_generic_payload& trans, sg_extension& sg,
+                         sc_core::sc_time& delay )
+    {
+        std::vector<sg_segment>& s = sg.segments;
+
+        unsigned int t = s.empty() ? N_TARGETS : decode(s[0].addr);
+        for (size_t i = 1; i < s.size() && t != N_TARGETS; i++)
+        {
+            if (decode(s[i].addr) != t) t = N_TARGETS;
+        }
+
+        if (t != N_TARGETS)
+        {
+            // one target, its addresses are relative to the range
+            for (size_t i = 0; i < s.size(); i++) s[i].addr -= base[t];
+            sg_transport( initiator_socket[t], trans, delay );
+            for (size_t i = 0; i < s.size(); i++) s[i].addr += base[t];
+            return;
+        }
+
+        // split, each segment as a transaction of its own
+        trans.clear_extension(&sg);
+        trans.set_command(sg.command);
+        for (size_t i = 0; i < s.size(); i++)
+        {
+            trans.set_address(s[i].addr);
+            trans.set_data_ptr(s[i].data);
+            trans.set_data_length(s[i].length);
+            trans.set_streaming_width(s[i].length);
+            trans.set_byte_enable_ptr(s[i].byte_en);
+            trans.set_byte_enable_length(s[i].byte_en ? s[i].length : 0);
+            trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+
+            b_transport(0, trans, delay);
+            s[i].status = trans.get_response_status();
+        }
+        trans.set_command(tlm::TLM_IGNORE_COMMAND);
+        trans.set_data_ptr(0);
+        trans.set_data_length(0);
+        trans.set_byte_enable_ptr(0);
+        trans.set_byte_enable_length(0);
+        trans.set_extension(&sg);
+
+        sg.executed = true;
+        sg_set_response(trans, sg);
+    }
+
+    // -------------------------------------------------------------------------
+    //！TLM2.0 debug transport routine for the router sockets
+    //
+    //! @return  The number of bytes transferred by the target
+    // ----------------------------------------------------------------------------
+    unsigned int transport_dbg( int id, tlm::tlm_generic_payload& trans )
+    {
+        sc_dt::uint64 addr = trans.get_address();
+        unsigned int  t    = decode(addr);
+        if (t == N_TARGETS) return 0;
+
+        trans.set_address(addr - base[t]);
+        unsigned int n = initiator_socket[t]->transport_dbg( trans );
+        trans.set_address(addr);
+        return n;
+    }
+
+    // -------------------------------------------------------------------------
+    //！TLM2.0 DMI request for the router sockets
+    //
+    //! The granted region is translated into router addresses and clipped to
+    //! the range of the target.
+    // ----------------------------------------------------------------------------
+    bool get_direct_mem_ptr( int id, tlm::tlm_generic_payload& trans,
+                             tlm::tlm_dmi& dmi_data )
+    {
+        sc_dt::uint64 addr = trans.get_address();
+        unsigned int  t    = decode(addr);
+        if (t == N_TARGETS) return false;
+
+        trans.set_address(addr - base[t]);
+        bool granted = initiator_socket[t]->get_direct_mem_ptr( trans, dmi_data );
+        trans.set_address(addr);
+        if (!granted) return false;
+
+        sc_dt::uint64 start = dmi_data.get_start_address();
+        sc_dt::uint64 end   = dmi_data.get_end_address();
+        if (end > size[t] - 1) end = size[t] - 1;
+
+        dmi_data.set_start_address(base[t] + start);
+        dmi_data.set_end_address(base[t] + end);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    //！TLM2.0 DMI invalidation from a target, passed to all initiators.
+    // ----------------------------------------------------------------------------
+    void invalidate_direct_mem_ptr( int t, sc_dt::uint64 start, sc_dt::uint64 end )
+    {
+        if (start > size[t] - 1) return;
+        if (end   > size[t] - 1) end = size[t] - 1;
+
+        for (unsigned int i = 0; i < N_INITIATORS; i++)
+        {
+            target_socket[i]->invalidate_direct_mem_ptr(base[t] + start, base[t] + end);
+        }
+    }
+
+    //! First address of the range of each initiator socket.
+    sc_dt::uint64 base[N_TARGETS];
+
+    //! Size of the range of each initiator socket.
+    sc_dt::uint64 size[N_TARGETS];
+};
+
+
+#endif
@@ -5,6 +5,8 @@
  *
  * @brief   Main program of TLM_demo3 (synchronized version)
  *
+ * Usage: tlm_demo3_sync [simulated time ns] [monitor interval s] [monitor file]
+ *
  * This file is part of TLM tutorials in the master course "Virtual Prototyping"
  * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
  * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
@@ -13,6 +15,7 @@
 
 #include <time.h>
 #include "../tlm_demo2/memory.h"
+#include "../tlm_demo2/speed_monitor.h"
 #include "processor0.h"
 #include "processor1.h"
 #include "bus.h"
@@ -35,12 +38,26 @@ int sc_main(int argc, char* argv[])
     i_cpu1->data_bus.bind( i_bus->data_bus1 );
     i_bus->initiator_socket.bind(i_mem->data_bus);
     
-    double  t_sim = 100;  // simulation time in nano second
+    double  t_sim    = (argc > 1) ? atof(argv[1]) : 100; // simulation time in nano second
+    double  interval = (argc > 2) ? atof(argv[2]) : 0;   // speed reports, 0 for none
+    FILE*   log      = (argc > 3) ? fopen(argv[3], "w") : stderr;
+    if (!log)
+    {
+        cerr << "Can not open " << argv[3] << endl;
+        return 1;
+    }
+    
+    // report the simulation speed while running
+    speed_monitor monitor;
+    if (interval > 0) monitor.start(interval, log);
     
     int t_start=clock();
     sc_start(t_sim, sc_core::SC_NS);
     int t_stop=clock();
     
+    monitor.stop();
+    if (log != stderr) fclose(log);
+    
     double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
     
     
@@ -0,0 +1,90 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/bench_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Benchmark of method based versus thread based processors
+ *
+ * Usage: tlm_demo4_bench [thread|method] [number of core pairs] [time in us]
+ *
+ * Instantiates the given number of producer/consumer pairs of tlm_demo3, each
+ * pair with its own bus and memory, and reports the host time and the peak
+ * memory usage of the simulation. Run it once per process type, as SystemC
+ * allows only one elaboration per process.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include <sys/resource.h>
+#include <sstream>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "processor0.h"
+#include "processor1.h"
+#include "processor_thread.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute the TLM_demo4 benchmark
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    bool    use_method = (argc > 1) ? (string(argv[1]) == "method") : true;
+    int     n_pairs    = (argc > 2) ? atoi(argv[2]) : 1000;
+    double  t_sim      = (argc > 3) ? atof(argv[3]) : 100;  // in micro second
+    
+    //! Instantiate and bind the modules, the console output is disabled
+    for (int i = 0; i < n_pairs; i++)
+    {
+        ostringstream id;
+        id << i;
+        
+        memory *i_mem = new memory(("i_memory_" + id.str()).c_str(), false);
+        bus    *i_bus = new bus(("i_bus_" + id.str()).c_str());
+        i_bus->initiator_socket.bind(i_mem->data_bus);
+        
+        if (use_method)
+        {
+            processor0 *i_cpu0 = new processor0(("i_cpu0_" + id.str()).c_str(), false);
+            processor1 *i_cpu1 = new processor1(("i_cpu1_" + id.str()).c_str(), false);
+            i_cpu0->data_bus.bind( i_bus->data_bus0 );
+            i_cpu1->data_bus.bind( i_bus->data_bus1 );
+        }
+        else
+        {
+            producer_thread *i_cpu0 = new producer_thread(("i_cpu0_" + id.str()).c_str());
+            consumer_thread *i_cpu1 = new consumer_thread(("i_cpu1_" + id.str()).c_str());
+            i_cpu0->data_bus.bind( i_bus->data_bus0 );
+            i_cpu1->data_bus.bind( i_bus->data_bus1 );
+        }
+    }
+    
+    int t_start=clock();
+    sc_start(t_sim, sc_core::SC_US);
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    
+    
+    // print simulation performance
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 4 benchmark : " << setw(6) << setfill(' ');
+    cout << (use_method ? "method" : "thread") << " processes     #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Core pairs       : " << setw(10) << setfill(' ') << n_pairs   <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" us          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu     <<" s           #"<< endl;
+    cout << "# Peak host memory : " << setw(10) << setfill(' ') << usage.ru_maxrss/1024 <<" MB          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,95 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor0.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor0.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor0 module
+//
+//! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
+//------------------------------------------------------------------------------
+processor0::processor0(sc_module_name  name, bool verbose) :
+processor_method (name),
+pc      (0x00000100),
+wdata   (0x00000000),
+addr    (0xFF000000),
+byte_en (0x000000FF),
+verbose (verbose)
+{
+    state = PREPARE_DATA;
+}
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC method running the producer program of tlm_demo3.
+//
+// Each activation executes one step of the program and returns. The data
+// prepare program starts from address 0x00000100 and executes 10 instructions
+// of 2 ns each to prepare a full-word data, which is then written to the
+// memory at the next address.
+// -----------------------------------------------------------------------------
+void processor0::program_step()
+{
+    switch (state)
+    {
+        case WRITE_DONE:
+            // the write completed after its transmission delay
+            if (verbose)
+            {
+                if (!bus_status)
+                    cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Succeeded.\n";
+                else
+                    cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+            }
+            
+            wdata++;
+            pc    = 0x00000100;
+            state = PREPARE_DATA;
+            // fall through
+            
+        case PREPARE_DATA:
+            if (verbose)
+            {
+                // debug print to track the program counter
+                cout << "     (cpu0) @ " << sc_time_stamp();
+                cout << ", prepareing write data, PC = 0x";
+                cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+            }
+            
+            pc += 4;
+            if (pc == 0x00000128) { state = WRITE_DATA; }
+            
+            next_trigger(2, SC_NS); // resume after the instruction delay
+            break;
+            
+        case WRITE_DATA:
+            if (verbose)
+            {
+                cout << "     (cpu0) @ " << sc_time_stamp();
+                cout << ", data prepared, start writing to memory. \n"  << endl;
+            }
+            
+            // bus communication, resumes after the transmission delay
+            bus_status = bus_readwrite(tlm::TLM_WRITE_COMMAND, addr++, 4,
+                                       reinterpret_cast<uint8_t *>(&wdata),
+                                       reinterpret_cast<uint8_t *>(&byte_en));
+            state = WRITE_DONE;
+            break;
+    }
+}
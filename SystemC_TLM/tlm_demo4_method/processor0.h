@@ -0,0 +1,53 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor0.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo4_method_processor0_h_
+#define _tlm_demo4_method_processor0_h_
+
+#include "processor_method.h"
+
+//------------------------------------------------------------------------------
+// Producer processor0 of tlm_demo3 ported to the method based processor.
+//------------------------------------------------------------------------------
+class processor0 : public  processor_method
+{
+public:
+    
+    //! Class Construct
+    processor0(sc_core::sc_module_name  name, bool verbose = true);
+    
+    
+private:
+    
+    //! States of the producer program.
+    enum { PREPARE_DATA, WRITE_DATA, WRITE_DONE };
+    
+    //! SystemC Method which executes the producer program step by step.
+    void program_step();
+    
+    //! Program counter of the data preparing program.
+    uint32_t pc;
+    
+    //! Data to write to the memory.
+    uint32_t wdata;
+    
+    //! Address to write to the memory.
+    uint32_t addr;
+    
+    //! Byte enable mask of the write access.
+    uint32_t byte_en;
+    
+    //! Print the program trace on the console.
+    bool verbose;
+};
+
+#endif
@@ -0,0 +1,115 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor1.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor1.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor1 module
+//
+//! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
+//------------------------------------------------------------------------------
+processor1::processor1(sc_core::sc_module_name  name, bool verbose) :
+processor_method (name),
+pc      (0x00000200),
+rdata   (0x00000000),
+addr    (0xFF000000),
+byte_en (0x000000FF),
+verbose (verbose)
+{
+    state = START;
+}
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC method running the consumer program of tlm_demo3.
+//
+// Each activation executes one step of the program and returns. After the
+// first data is written into memory, the consumer reads one word and runs the
+// data processing program starting from address 0x00000200, which executes 10
+// instructions of 2 ns each, before it reads the next word.
+// -----------------------------------------------------------------------------
+void processor1::program_step()
+{
+    switch (state)
+    {
+        case START:
+            state = READ_DATA;
+            next_trigger(25, SC_NS); // wait until the first data writtten into memory
+            break;
+            
+        case READ_DONE:
+            // the read completed after its transmission delay
+            if (bus_status)
+            {
+                if (verbose)
+                    cout << "     (cpu1) @ " << sc_time_stamp() << ", Read Failed.\n";
+                
+                // the read is issued again
+                state = READ_DATA;
+                next_trigger(SC_ZERO_TIME);
+                break;
+            }
+            
+            if (verbose)
+                cout << "     (cpu1) @ " << sc_time_stamp() << ", Read Succeeded.\n";
+            pc    = 0x00000200;
+            state = PROCESS_DATA;
+            // fall through
+            
+        case PROCESS_DATA:
+            if (verbose && pc == 0x00000200)
+            {
+                cout << "(cpu1)      @ " << sc_time_stamp();
+                cout << ", data received = 0x";
+                cout <<  setw(2) << setfill('0') << hex << uppercase << rdata << endl;
+            }
+            
+            if (pc < 0x00000228)
+            {
+                if (verbose)
+                {
+                    // debug print to track the program counter
+                    cout << "(cpu1)      @ " << sc_time_stamp();
+                    cout << ", processing received data, PC = 0x";
+                    cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+                }
+                
+                pc += 4;
+                next_trigger(2, SC_NS); // resume after the instruction delay
+                break;
+            }
+            
+            if (verbose)
+            {
+                cout << "(cpu1)      @ " << sc_time_stamp();
+                cout << ", data processing complete.\n" << endl;
+            }
+            
+            // the next read is issued without delay
+            state = READ_DATA;
+            // fall through
+            
+        case READ_DATA:
+            // bus communication, resumes after the transmission delay
+            bus_status = bus_readwrite(tlm::TLM_READ_COMMAND, addr++, 4,
+                                       reinterpret_cast<uint8_t *>(&rdata),
+                                       reinterpret_cast<uint8_t *>(&byte_en));
+            state = READ_DONE;
+            break;
+    }
+}
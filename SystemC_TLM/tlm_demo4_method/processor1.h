@@ -0,0 +1,55 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor1.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo4_method_processor1_h_
+#define _tlm_demo4_method_processor1_h_
+
+#include "processor_method.h"
+
+//------------------------------------------------------------------------------
+// Consumer processor1 of tlm_demo3 ported to the method based processor.
+//------------------------------------------------------------------------------
+class processor1 : public  processor_method
+{
+public:
+    
+    //! Class Construct
+    processor1(sc_core::sc_module_name  name, bool verbose = true);
+    
+
+    
+private:
+    
+    //! States of the consumer program.
+    enum { START, READ_DATA, READ_DONE, PROCESS_DATA };
+    
+    //! SystemC Method which executes the consumer program step by step.
+    void program_step();
+    
+    //! Program counter of the data processing program.
+    uint32_t pc;
+    
+    //! Data read from the memory.
+    uint32_t rdata;
+    
+    //! Address to read from the memory.
+    uint32_t addr;
+    
+    //! Byte enable mask of the read access.
+    uint32_t byte_en;
+    
+    //! Print the program trace on the console.
+    bool verbose;
+    
+};
+
+#endif
@@ -0,0 +1,93 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor_method.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Method based processor module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor_method.h"
+
+SC_HAS_PROCESS( processor_method );
+
+using namespace std;
+using namespace sc_core;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor_method module
+//
+//! @param name        SystemC module name
+//------------------------------------------------------------------------------
+processor_method::processor_method(sc_module_name  name):
+sc_module (name),
+data_bus("data_bus"),
+state(0),
+bus_status(0)
+{
+    //! Attaches the transaction tags to the payload, once for all transactions.
+    tags = txn_attach(trans, this);
+    
+    //! Defines the function ::program_step() as a SystemC method. It is
+    //! triggered once at start of simulation and then only by next_trigger().
+    SC_METHOD (program_step);
+}
+
+
+
+// ----------------------------------------------------------------------------
+//! Function to handle read and write from the SystemC method ::program_step().
+//
+//! Unlike processor::bus_readwrite() this function can not wait for the
+//! transmission delay. It schedules the next activation of the method after
+//! the delay instead, so the caller has to return from ::program_step() after
+//! the access and continue with the next state. The access completes only
+//! then, so the caller keeps the return code in ::bus_status and checks it in
+//! that state.
+//
+//! @param  cmd           The TLM access command, read or write
+//! @param  addr          The address for the access
+//! @param  data_len      The number of bytes to read
+//! @param  data_ptr      Vector for the access data
+//! @param  byte_en_ptr   The byte enable mask for the access
+//
+//! @return  Zero on success. A return code otherwise.
+// ----------------------------------------------------------------------------
+int processor_method::bus_readwrite(tlm::tlm_command  cmd,
+                                    uint64_t          addr,
+                                    int               data_len,
+                                    uint8_t*          data_ptr,
+                                    uint8_t*          byte_en_ptr)
+{
+    PROF_SCOPE("processor::bus_readwrite");
+    
+    // Initialize 8 out of the 10 attributes, byte_enable_length being unused,
+    // the extensions are the transaction tags
+    trans.set_command(cmd);
+    trans.set_address(addr);
+    trans.set_data_ptr(data_ptr);
+    trans.set_data_length(data_len);
+    trans.set_streaming_width(data_len);//=data_length indicates no streaming
+    trans.set_byte_enable_ptr(byte_en_ptr);
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    
+    //  time delay
+    sc_time delay    = SC_ZERO_TIME;
+    
+    txn_stamp(tags, delay);
+    
+    // Blocking transport call, the targets must not call wait() because
+    // the initiator is a method process.
+    data_bus->b_transport(trans, delay);
+    
+    // resume after the transmission delay
+    next_trigger(delay);
+    
+    // For now just simple non-zero return code on error
+    return  trans.is_response_ok () ? 0 : -1;
+}
@@ -0,0 +1,69 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor_method.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Method based processor module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo4_method_processor_method_h_
+#define _tlm_demo4_method_processor_method_h_
+
+#include <iomanip>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo2/txn_extensions.h"
+
+
+//------------------------------------------------------------------------------
+// SystemC TLM processor module driven by an SC_METHOD instead of an SC_THREAD.
+//
+// The program is written as a resumable state machine: ::program_step() runs
+// until the program has to consume time, schedules its next activation with
+// next_trigger() and returns. The current position in the program is kept in
+// ::state, so no thread stack and no context switch is needed per wait.
+//------------------------------------------------------------------------------
+class processor_method : public sc_core::sc_module
+{
+public:
+
+    //! Class Construct
+    processor_method(sc_core::sc_module_name  name);
+    
+    // TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<processor_method> data_bus;
+   
+protected:
+    
+    //! SystemC method executing the program until its next timing point.
+    virtual void program_step() = 0;
+    
+    //! The blocking transport routine for the socket.
+    virtual int bus_readwrite(tlm::tlm_command     cmd,
+                              uint64_t             addr,
+                              int                  data_len,
+                              uint8_t*             data_ptr,
+                              uint8_t*             byte_en_ptr);
+    
+    //! Current position of the program, defined by the derived processor.
+    int state;
+    
+    //! Return code of the last bus_readwrite(), checked in the state resumed
+    //! after its transmission delay.
+    int bus_status;
+    
+    //! The generic payload.
+    tlm::tlm_generic_payload  trans;
+    
+    //! The transaction tags attached to ::trans.
+    txn_tags  tags;
+
+};
+
+#endif
@@ -0,0 +1,166 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo4_method/processor_thread.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Thread based producer/consumer processors for the benchmark
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo4_method_processor_thread_h_
+#define _tlm_demo4_method_processor_thread_h_
+
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "../tlm_demo2/host_profiler.h"
+#include "../tlm_demo2/txn_extensions.h"
+
+
+//------------------------------------------------------------------------------
+// Thread based counterpart of processor_method for the benchmark.
+//
+// The processor of tlm_demo2 also passes each access through its
+// write-combining buffer. This processor does the same work per access as
+// processor_method, so the benchmark compares only the process types.
+//------------------------------------------------------------------------------
+class processor_thread : public sc_core::sc_module
+{
+public:
+    
+    SC_HAS_PROCESS( processor_thread );
+    
+    //! Class Construct
+    processor_thread(sc_core::sc_module_name  name) :
+    sc_module (name),
+    data_bus("data_bus")
+    {
+        //! Attaches the transaction tags to the payload, once for all transactions.
+        tags = txn_attach(trans, this);
+        
+        //! Runs the function ::program_main() in a SystemC thread.
+        SC_THREAD (program_main);
+    }
+    
+    // TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<processor_thread> data_bus;
+    
+protected:
+    
+    //! SystemC Thread running the program.
+    virtual void program_main() = 0;
+    
+    //! Same as processor_method::bus_readwrite(), but waits for the delay.
+    int bus_readwrite(tlm::tlm_command  cmd,
+                      uint64_t          addr,
+                      int               data_len,
+                      uint8_t*          data_ptr,
+                      uint8_t*          byte_en_ptr)
+    {
+        PROF_SCOPE("processor::bus_readwrite");
+        
+        trans.set_command(cmd);
+        trans.set_address(addr);
+        trans.set_data_ptr(data_ptr);
+        trans.set_data_length(data_len);
+        trans.set_streaming_width(data_len);//=data_length indicates no streaming
+        trans.set_byte_enable_ptr(byte_en_ptr);
+        trans.set_dmi_allowed(false);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        
+        sc_core::sc_time delay = sc_core::SC_ZERO_TIME;
+        txn_stamp(tags, delay);
+        data_bus->b_transport(trans, delay);
+        
+        // wait for the transmission delay
+        wait(delay);
+        
+        return  trans.is_response_ok () ? 0 : -1;
+    }
+    
+    //! The generic payload.
+    tlm::tlm_generic_payload  trans;
+    
+    //! The transaction tags attached to ::trans.
+    txn_tags  tags;
+};
+
+//------------------------------------------------------------------------------
+// Producer of tlm_demo3_sync (processor0) without console output, used as the
+// SC_THREAD reference in the benchmark.
+//------------------------------------------------------------------------------
+class producer_thread : public processor_thread
+{
+public:
+    
+    //! Class Construct
+    producer_thread(sc_core::sc_module_name  name) : processor_thread (name) {}
+    
+private:
+    
+    //! SystemC Thread running the producer program.
+    void program_main()
+    {
+        uint32_t byte_en = 0x000000FF;    // byte enable ptr
+        uint32_t wdata   = 0x00000000;    // data to write to the memory
+        uint32_t addr    = 0xFF000000;    // address to write to the memory
+        
+        while(true)
+        {
+            // 10 instructions to prepare a full-word data
+            for (uint32_t pc = 0x00000100; pc<0x00000128; pc+=4)
+            {
+                wait(sc_core::sc_time(2, sc_core::SC_NS));
+            }
+            
+            bus_readwrite(tlm::TLM_WRITE_COMMAND, addr++, 4,
+                          reinterpret_cast<uint8_t *>(&wdata),
+                          reinterpret_cast<uint8_t *>(&byte_en));
+            wdata++;
+        }
+    }
+};
+
+
+//------------------------------------------------------------------------------
+// Consumer of tlm_demo3_sync (processor1) without console output, used as the
+// SC_THREAD reference in the benchmark.
+//------------------------------------------------------------------------------
+class consumer_thread : public processor_thread
+{
+public:
+    
+    //! Class Construct
+    consumer_thread(sc_core::sc_module_name  name) : processor_thread (name) {}
+    
+private:
+    
+    //! SystemC Thread running the consumer program.
+    void program_main()
+    {
+        uint32_t byte_en = 0x000000FF;    // byte enable ptr
+        uint32_t rdata   = 0x00000000;    // data read from the memory
+        uint32_t addr    = 0xFF000000;    // address to read from the memory
+        
+        wait(sc_core::sc_time(25, sc_core::SC_NS));
+        
+        while(true)
+        {
+            if(!bus_readwrite(tlm::TLM_READ_COMMAND, addr++, 4,
+                              reinterpret_cast<uint8_t *>(&rdata),
+                              reinterpret_cast<uint8_t *>(&byte_en))
+               ){
+                // 10 instructions to process a full-word data
+                for (uint32_t pc = 0x00000200; pc<0x00000228; pc+=4)
+                {
+                    wait(sc_core::sc_time(2, sc_core::SC_NS));
+                }
+            }
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,139 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_arena.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Arena allocator for coroutine frames
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_co_arena_h_
+#define _tlm_demo5_coroutine_co_arena_h_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+
+//------------------------------------------------------------------------------
+//! Pooled allocator for coroutine frames.
+//
+//! Frames are rounded up to a multiple of BLOCK_SIZE bytes and served from
+//! one free list per size class. The free lists are refilled from large slabs,
+//! so creating and destroying frames never touches the heap in steady state.
+//! Frames larger than MAX_SIZE fall back to the global operator new.
+//! The SystemC kernel runs all processes on one host thread, so the arena is
+//! not synchronized.
+//------------------------------------------------------------------------------
+class co_arena
+{
+public:
+    
+    //! Granularity of the size classes in bytes.
+    static const size_t BLOCK_SIZE = 64;
+    
+    //! Largest frame served from the arena in bytes.
+    static const size_t MAX_SIZE   = 2048;
+    
+    //! Size of one slab requested from the heap in bytes.
+    static const size_t SLAB_SIZE  = 64 * 1024;
+    
+    //! The arena shared by all coroutines of the simulation.
+    static co_arena& instance()
+    {
+        static co_arena arena;
+        return arena;
+    }
+    
+    //! Allocates a frame of n bytes.
+    void* allocate(size_t n)
+    {
+        size_t c = size_class(n);
+        bytes_used += (c + 1) * BLOCK_SIZE;
+        if (bytes_used > bytes_peak) bytes_peak = bytes_used;
+        
+        if (c >= N_CLASSES) return ::operator new(n);
+        
+        if (free_list[c] == 0) refill(c);
+        free_block* b = free_list[c];
+        free_list[c]  = b->next;
+        return b;
+    }
+    
+    //! Returns a frame of n bytes to the arena.
+    void deallocate(void* p, size_t n)
+    {
+        size_t c = size_class(n);
+        bytes_used -= (c + 1) * BLOCK_SIZE;
+        
+        if (c >= N_CLASSES) { ::operator delete(p); return; }
+        
+        free_block* b = static_cast<free_block*>(p);
+        b->next       = free_list[c];
+        free_list[c]  = b;
+    }
+    
+    //! Bytes currently allocated to coroutine frames.
+    size_t get_bytes_used() const { return bytes_used; }
+    
+    //! Maximum number of bytes allocated to coroutine frames at a time.
+    size_t get_bytes_peak() const { return bytes_peak; }
+    
+    //! Bytes requested from the heap for slabs.
+    size_t get_bytes_reserved() const { return slabs.size() * SLAB_SIZE; }
+    
+    ~co_arena()
+    {
+        for (size_t i = 0; i < slabs.size(); i++) std::free(slabs[i]);
+    }
+    
+private:
+    
+    //! Number of size classes.
+    static const size_t N_CLASSES = MAX_SIZE / BLOCK_SIZE;
+    
+    //! Free block, linked in place.
+    struct free_block { free_block* next; };
+    
+    co_arena() : bytes_used(0), bytes_peak(0)
+    {
+        for (size_t c = 0; c < N_CLASSES; c++) free_list[c] = 0;
+    }
+    
+    //! Size class of a frame of n bytes.
+    static size_t size_class(size_t n) { return (n - 1) / BLOCK_SIZE; }
+    
+    //! Cuts a new slab into blocks of size class c.
+    void refill(size_t c)
+    {
+        size_t size = (c + 1) * BLOCK_SIZE;
+        char*  slab = static_cast<char*>(std::malloc(SLAB_SIZE));
+        if (slab == 0) throw std::bad_alloc();
+        slabs.push_back(slab);
+        
+        for (size_t offset = 0; offset + size <= SLAB_SIZE; offset += size)
+        {
+            free_block* b = reinterpret_cast<free_block*>(slab + offset);
+            b->next       = free_list[c];
+            free_list[c]  = b;
+        }
+    }
+    
+    //! Free lists, one per size class.
+    free_block* free_list[N_CLASSES];
+    
+    //! Slabs requested from the heap.
+    std::vector<char*> slabs;
+    
+    //! Bytes currently allocated.
+    size_t bytes_used;
+    
+    //! Maximum bytes allocated at a time.
+    size_t bytes_peak;
+};
+
+#endif
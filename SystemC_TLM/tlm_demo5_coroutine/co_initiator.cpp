@@ -0,0 +1,74 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_initiator.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Coroutine based initiator module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "co_initiator.h"
+
+using namespace sc_core;
+
+
+// ----------------------------------------------------------------------------
+//! Blocking transport of one word for the awaiters of co_bus.
+//
+//! @param  cmd           The TLM access command, read or write
+//! @param  addr          The address for the access
+//! @param  data          The access data
+//! @param  byte_en       The byte enable mask for the access
+//
+//! @return  The delay annotated by the target.
+// ----------------------------------------------------------------------------
+sc_time co_bus::transport(tlm::tlm_command cmd, uint64_t addr,
+                          uint32_t& data, uint32_t& byte_en)
+{
+    // Initialize 8 out of the 10 attributes, byte_enable_length being unused,
+    // the extensions are the transaction tags
+    trans.set_command(cmd);
+    trans.set_address(addr);
+    trans.set_data_ptr(reinterpret_cast<uint8_t *>(&data));
+    trans.set_data_length(4);
+    trans.set_streaming_width(4);//=data_length indicates no streaming
+    trans.set_byte_enable_ptr(reinterpret_cast<uint8_t *>(&byte_en));
+    trans.set_dmi_allowed(false);
+    trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+    
+    //  time delay
+    sc_time delay = SC_ZERO_TIME;
+    
+    txn_stamp(tags, delay);
+    
+    // Blocking transport call
+    socket->b_transport(trans, delay);
+    
+    return delay;
+}
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the co_initiator module
+//
+//! @param name        SystemC module name
+//------------------------------------------------------------------------------
+co_initiator::co_initiator(sc_module_name  name):
+sc_module (name),
+data_bus("data_bus"),
+bus(data_bus, this)
+{
+}
+
+
+//------------------------------------------------------------------------------
+//! Starts the program of the initiator on the scheduler.
+//------------------------------------------------------------------------------
+void co_initiator::start_of_simulation()
+{
+    co_scheduler::instance().spawn(program_main());
+}
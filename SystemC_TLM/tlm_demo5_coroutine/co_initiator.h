@@ -0,0 +1,136 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_initiator.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Coroutine based initiator module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_co_initiator_h_
+#define _tlm_demo5_coroutine_co_initiator_h_
+
+#include <iomanip>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "../tlm_demo2/txn_extensions.h"
+#include "co_scheduler.h"
+
+
+class co_initiator;
+
+//------------------------------------------------------------------------------
+//! Bus interface of a coroutine initiator.
+//
+//! read() and write() return awaiters which issue the blocking transport call
+//! and suspend the calling task for the annotated delay, e.g.
+//! `uint32_t data = co_await bus.read(addr);`. The targets must not call
+//! wait(), because the tasks are resumed by a method process.
+//------------------------------------------------------------------------------
+class co_bus
+{
+public:
+    
+    //! Awaiter of one bus access.
+    struct access
+    {
+        co_bus*           bus;
+        tlm::tlm_command  cmd;
+        uint64_t          addr;
+        uint32_t          data;
+        uint32_t          byte_en;
+        
+        bool await_ready() const noexcept { return false; }
+        
+        //! Issues the transaction and resumes after the annotated delay.
+        bool await_suspend(std::coroutine_handle<> h)
+        {
+            sc_core::sc_time delay = bus->transport(cmd, addr, data, byte_en);
+            if (delay == sc_core::SC_ZERO_TIME) return false;
+            co_scheduler::instance().schedule(h, delay);
+            return true;
+        }
+        
+        //! Read data of a read access, zero on success for a write access.
+        uint32_t await_resume() const noexcept
+        {
+            if (cmd == tlm::TLM_READ_COMMAND) return data;
+            return bus->response_ok() ? 0 : -1;
+        }
+    };
+    
+    //! Class constructor, attaches the transaction tags of owner to the payload.
+    co_bus(tlm_utils::simple_initiator_socket<co_initiator>& socket,
+           const sc_core::sc_object* owner)
+    : socket(socket) { tags = txn_attach(trans, owner); }
+    
+    //! Reads a word, resumes with the read data.
+    access read(uint64_t addr, uint32_t byte_en = 0xFFFFFFFF)
+    {
+        access a = { this, tlm::TLM_READ_COMMAND, addr, 0, byte_en };
+        return a;
+    }
+    
+    //! Writes a word, resumes with zero on success.
+    access write(uint64_t addr, uint32_t data, uint32_t byte_en = 0xFFFFFFFF)
+    {
+        access a = { this, tlm::TLM_WRITE_COMMAND, addr, data, byte_en };
+        return a;
+    }
+    
+    //! Status of the last access.
+    bool response_ok() const { return trans.is_response_ok(); }
+    
+private:
+    
+    //! Blocking transport of one word, returns the annotated delay.
+    sc_core::sc_time transport(tlm::tlm_command cmd, uint64_t addr,
+                               uint32_t& data, uint32_t& byte_en);
+    
+    //! The initiator socket of the owning module.
+    tlm_utils::simple_initiator_socket<co_initiator>& socket;
+    
+    //! The generic payload, one access is outstanding at a time.
+    tlm::tlm_generic_payload  trans;
+    
+    //! The transaction tags attached to ::trans.
+    txn_tags  tags;
+};
+
+
+//------------------------------------------------------------------------------
+//! SystemC TLM initiator module running its program as a coroutine.
+//
+//! The module has no SystemC process of its own. Its ::program_main() task is
+//! started by the co_scheduler at start of simulation and only occupies its
+//! coroutine frame while suspended.
+//------------------------------------------------------------------------------
+class co_initiator : public sc_core::sc_module
+{
+public:
+    
+    //! Class Construct
+    co_initiator(sc_core::sc_module_name  name);
+    
+    // TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<co_initiator> data_bus;
+    
+protected:
+    
+    //! The program of the initiator.
+    virtual co_task<void> program_main() = 0;
+    
+    //! Bus interface used by the program.
+    co_bus bus;
+    
+private:
+    
+    //! Hands the program over to the scheduler.
+    void start_of_simulation();
+};
+
+#endif
@@ -0,0 +1,106 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_scheduler.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Scheduler module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "co_scheduler.h"
+
+SC_HAS_PROCESS( co_scheduler );
+
+using namespace sc_core;
+
+co_scheduler* co_scheduler::the_scheduler = 0;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the co_scheduler module
+//
+//! @param name        SystemC module name
+//------------------------------------------------------------------------------
+co_scheduler::co_scheduler(sc_module_name  name) :
+sc_module (name),
+seq (0),
+resume_count (0),
+running (false)
+{
+    if (the_scheduler != 0)
+    {
+        SC_REPORT_ERROR("co_scheduler", "only one scheduler may be instantiated");
+    }
+    the_scheduler = this;
+    
+    //! Defines the function ::run() as the only process of all tasks.
+    SC_METHOD (run);
+}
+
+
+//------------------------------------------------------------------------------
+//! Returns the scheduler of the simulation.
+//------------------------------------------------------------------------------
+co_scheduler& co_scheduler::instance()
+{
+    if (the_scheduler == 0)
+    {
+        SC_REPORT_FATAL("co_scheduler", "no scheduler instantiated");
+    }
+    return *the_scheduler;
+}
+
+
+//------------------------------------------------------------------------------
+//! Starts a task at the current simulation time. The scheduler takes over the
+//! ownership of the task frame.
+//
+//! @param task  The task to run
+//------------------------------------------------------------------------------
+void co_scheduler::spawn(co_task<void>&& task)
+{
+    schedule(task.release(), SC_ZERO_TIME);
+}
+
+
+//------------------------------------------------------------------------------
+//! Queues a suspended task.
+//
+//! @param handle  The suspended task
+//! @param delay   Time from now until the task is resumed
+//------------------------------------------------------------------------------
+void co_scheduler::schedule(std::coroutine_handle<> handle, const sc_time& delay)
+{
+    entry e = { sc_time_stamp() + delay, seq++, handle };
+    ready.push(e);
+    
+    // tasks queued by ::run() itself are picked up before it returns, tasks
+    // queued during elaboration by the initial activation of ::run()
+    if (!running && sc_is_running()) wakeup.notify(SC_ZERO_TIME);
+}
+
+
+//------------------------------------------------------------------------------
+//! SystemC method resuming all tasks which are due at the current time.
+//------------------------------------------------------------------------------
+void co_scheduler::run()
+{
+    const sc_time& now = sc_time_stamp();
+    
+    running = true;
+    while (!ready.empty() && ready.top().time <= now)
+    {
+        std::coroutine_handle<> h = ready.top().handle;
+        ready.pop();
+        resume_count++;
+        h.resume();
+    }
+    running = false;
+    
+    // resume at the next wake up time or when a new task is queued
+    if (ready.empty()) next_trigger(wakeup);
+    else               next_trigger(ready.top().time - now, wakeup);
+}
@@ -0,0 +1,113 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_scheduler.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Scheduler module resuming coroutine tasks
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_co_scheduler_h_
+#define _tlm_demo5_coroutine_co_scheduler_h_
+
+#include <queue>
+#include <vector>
+#include "systemc"
+#include "co_task.h"
+
+
+//------------------------------------------------------------------------------
+//! Scheduler module for coroutine tasks.
+//
+//! All coroutine tasks of the simulation are resumed by the single SC_METHOD
+//! ::run() of this module. Suspended tasks are kept in a queue ordered by
+//! their wake up time. Each activation resumes every task which is due at the
+//! current simulation time and triggers the method again at the earliest wake
+//! up time of the remaining tasks.
+//------------------------------------------------------------------------------
+class co_scheduler : public sc_core::sc_module
+{
+public:
+    
+    //! Class constructor, only one scheduler may be instantiated.
+    co_scheduler(sc_core::sc_module_name  name);
+    
+    //! The scheduler of the simulation.
+    static co_scheduler& instance();
+    
+    //! Starts a task at the current simulation time.
+    void spawn(co_task<void>&& task);
+    
+    //! Resumes a suspended task after the given delay.
+    void schedule(std::coroutine_handle<> handle, const sc_core::sc_time& delay);
+    
+    //! Number of task resumptions since start of simulation.
+    uint64_t get_resume_count() const { return resume_count; }
+    
+private:
+    
+    //! Suspended task and its wake up time.
+    struct entry
+    {
+        sc_core::sc_time         time;
+        uint64_t                 seq;    // keeps FIFO order for equal times
+        std::coroutine_handle<>  handle;
+        
+        bool operator>(const entry& other) const
+        {
+            return time > other.time || (time == other.time && seq > other.seq);
+        }
+    };
+    
+    //! SystemC method resuming all tasks which are due.
+    void run();
+    
+    //! Suspended tasks, earliest wake up time first.
+    std::priority_queue<entry, std::vector<entry>, std::greater<entry> > ready;
+    
+    //! Sequence number of the next queue entry.
+    uint64_t seq;
+    
+    //! Number of task resumptions.
+    uint64_t resume_count;
+    
+    //! Set while ::run() resumes tasks.
+    bool running;
+    
+    //! Notified when a task is queued from outside ::run().
+    sc_core::sc_event wakeup;
+    
+    //! The scheduler instance.
+    static co_scheduler* the_scheduler;
+};
+
+
+//------------------------------------------------------------------------------
+//! Awaiter suspending the calling task for a simulated time.
+//------------------------------------------------------------------------------
+struct co_delay
+{
+    sc_core::sc_time t;
+    
+    bool await_ready() const noexcept { return t == sc_core::SC_ZERO_TIME; }
+    
+    void await_suspend(std::coroutine_handle<> h)
+    {
+        co_scheduler::instance().schedule(h, t);
+    }
+    
+    void await_resume() const noexcept {}
+};
+
+//! Suspends the calling task for time t, use as co_await delay(2_ns).
+inline co_delay delay(const sc_core::sc_time& t) { return co_delay{t}; }
+
+//! Time literals for coroutine programs.
+inline sc_core::sc_time operator""_ps(unsigned long long v) { return sc_core::sc_time(double(v), sc_core::SC_PS); }
+inline sc_core::sc_time operator""_ns(unsigned long long v) { return sc_core::sc_time(double(v), sc_core::SC_NS); }
+inline sc_core::sc_time operator""_us(unsigned long long v) { return sc_core::sc_time(double(v), sc_core::SC_US); }
+
+#endif
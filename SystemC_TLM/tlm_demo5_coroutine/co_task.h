@@ -0,0 +1,196 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/co_task.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Coroutine task type for initiator programs
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_co_task_h_
+#define _tlm_demo5_coroutine_co_task_h_
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include "co_arena.h"
+
+
+template <typename T> class co_task;
+
+//------------------------------------------------------------------------------
+//! Promise part shared by all task types.
+//
+//! Frames are allocated from the co_arena. A task starts suspended. When it is
+//! awaited by another task, it runs until its first suspension point and
+//! resumes the awaiting task on completion. A task handed to the co_scheduler
+//! is detached and destroys its own frame on completion.
+//------------------------------------------------------------------------------
+class co_promise_base
+{
+public:
+    
+    //! Awaiter at the end of the task, transfers control to the awaiting task.
+    struct final_awaiter
+    {
+        bool await_ready() noexcept { return false; }
+        
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept
+        {
+            co_promise_base& p = h.promise();
+            if (p.continuation) return p.continuation;
+            if (p.detached) h.destroy();
+            return std::noop_coroutine();
+        }
+        
+        void await_resume() noexcept {}
+    };
+    
+    co_promise_base() : detached(false) {}
+    
+    std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+    final_awaiter       final_suspend()   noexcept { return final_awaiter(); }
+    
+    //! Exceptions are not propagated between simulated programs.
+    void unhandled_exception() { std::terminate(); }
+    
+    //! Frame allocation from the arena.
+    static void* operator new(size_t n) { return co_arena::instance().allocate(n); }
+    
+    //! Frame deallocation to the arena.
+    static void operator delete(void* p, size_t n) { co_arena::instance().deallocate(p, n); }
+    
+    //! The task awaiting the completion of this task.
+    std::coroutine_handle<> continuation;
+    
+    //! Task is owned by the scheduler instead of a co_task object.
+    bool detached;
+};
+
+
+//------------------------------------------------------------------------------
+//! Coroutine task returning a value of type T.
+//
+//! @tparam T   Type of the value returned with co_return.
+//------------------------------------------------------------------------------
+template <typename T>
+class co_task
+{
+public:
+    
+    struct promise_type : co_promise_base
+    {
+        co_task get_return_object()
+        {
+            return co_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        
+        void return_value(T v) { value = std::move(v); }
+        
+        T value;
+    };
+    
+    //! Awaiter starting the task and resuming the caller on completion.
+    struct awaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+        
+        bool await_ready() noexcept { return false; }
+        
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept
+        {
+            handle.promise().continuation = caller;
+            return handle;
+        }
+        
+        T await_resume() { return std::move(handle.promise().value); }
+    };
+    
+    co_task(co_task&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    
+    ~co_task() { if (handle) handle.destroy(); }
+    
+    awaiter operator co_await() && noexcept { return awaiter{handle}; }
+    
+    //! Hands the frame over to the caller, used by the scheduler.
+    std::coroutine_handle<> release()
+    {
+        handle.promise().detached = true;
+        return std::exchange(handle, nullptr);
+    }
+    
+private:
+    
+    explicit co_task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    
+    co_task(const co_task&)            = delete;
+    co_task& operator=(const co_task&) = delete;
+    
+    //! The coroutine frame owned by this task.
+    std::coroutine_handle<promise_type> handle;
+};
+
+
+//------------------------------------------------------------------------------
+//! Coroutine task without return value.
+//------------------------------------------------------------------------------
+template <>
+class co_task<void>
+{
+public:
+    
+    struct promise_type : co_promise_base
+    {
+        co_task get_return_object()
+        {
+            return co_task(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        
+        void return_void() {}
+    };
+    
+    //! Awaiter starting the task and resuming the caller on completion.
+    struct awaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+        
+        bool await_ready() noexcept { return false; }
+        
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> caller) noexcept
+        {
+            handle.promise().continuation = caller;
+            return handle;
+        }
+        
+        void await_resume() {}
+    };
+    
+    co_task(co_task&& other) noexcept : handle(other.handle) { other.handle = nullptr; }
+    
+    ~co_task() { if (handle) handle.destroy(); }
+    
+    awaiter operator co_await() && noexcept { return awaiter{handle}; }
+    
+    //! Hands the frame over to the caller, used by the scheduler.
+    std::coroutine_handle<> release()
+    {
+        handle.promise().detached = true;
+        return std::exchange(handle, nullptr);
+    }
+    
+private:
+    
+    explicit co_task(std::coroutine_handle<promise_type> h) : handle(h) {}
+    
+    co_task(const co_task&)            = delete;
+    co_task& operator=(const co_task&) = delete;
+    
+    //! The coroutine frame owned by this task.
+    std::coroutine_handle<promise_type> handle;
+};
+
+#endif
@@ -0,0 +1,90 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/processor0.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor0.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor0 module
+//
+//! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
+//------------------------------------------------------------------------------
+processor0::processor0(sc_module_name  name, bool verbose) :
+co_initiator (name),
+verbose (verbose)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//! The coroutine running the producer program of tlm_demo3.
+// -----------------------------------------------------------------------------
+co_task<void> processor0::program_main()
+{
+    uint32_t byte_en = 0x000000FF;    // byte enable ptr
+    uint32_t wdata   = 0x00000000;    // data to write to the memory
+    uint32_t addr    = 0xFF000000;    // address to write to the memory
+    
+    while(true)
+    {
+        wdata = co_await prepare_data ();
+        
+        // bus communication
+        if(!co_await bus.write(addr++, wdata, byte_en))
+        {
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Succeeded.\n";
+        }else{
+            if (verbose)
+                cout << "     (cpu0) @ " << sc_time_stamp() << ", Write Failed.\n";
+        }
+    }
+}
+
+
+
+// -----------------------------------------------------------------------------
+// The funtion   simulates the instructions execution to process received data
+// before write to the memory by increment of program counter (PC). Assume
+// the data prepare program starts from address 0x00000100 in the memory, and
+// further assume that it executes 10 instructions to prepare a full- word data.
+// -----------------------------------------------------------------------------
+co_task<uint32_t> processor0::prepare_data ()
+{
+    static uint32_t data = 0;
+    
+    for (uint32_t pc = 0x00000100; pc<0x00000128; pc+=4)
+    {
+        if (verbose)
+        {
+            // debug print to track the program counter
+            cout << "     (cpu0) @ " << sc_time_stamp();
+            cout << ", prepareing write data, PC = 0x";
+            cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        }
+        
+        co_await delay(2_ns); // wait for the instruction delay
+    }
+    if (verbose)
+    {
+        cout << "     (cpu0) @ " << sc_time_stamp();
+        cout << ", data prepared, start writing to memory. \n"  << endl;
+    }
+    
+    co_return data++;
+}
@@ -0,0 +1,41 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/processor0.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor0 module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_processor0_h_
+#define _tlm_demo5_coroutine_processor0_h_
+
+#include "co_initiator.h"
+
+//------------------------------------------------------------------------------
+// Producer processor0 of tlm_demo3 written as a coroutine program.
+//------------------------------------------------------------------------------
+class processor0 : public  co_initiator
+{
+public:
+    
+    //! Class Construct
+    processor0(sc_core::sc_module_name  name, bool verbose = true);
+    
+    
+private:
+    
+    //! Coroutine running the producer program.
+    co_task<void> program_main();
+    
+    // function to simulate the data prepareing program
+    co_task<uint32_t> prepare_data();
+    
+    //! Print the program trace on the console.
+    bool verbose;
+};
+
+#endif
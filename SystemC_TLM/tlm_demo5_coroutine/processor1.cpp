@@ -0,0 +1,94 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/processor1.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "processor1.h"
+
+
+using namespace std;
+using namespace sc_core;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the processor1 module
+//
+//! @param name        SystemC module name
+//! @param verbose     Print the program trace on the console
+//------------------------------------------------------------------------------
+processor1::processor1(sc_core::sc_module_name  name, bool verbose) :
+co_initiator (name),
+verbose (verbose)
+{
+    
+}
+
+// -----------------------------------------------------------------------------
+//! The coroutine running the consumer program of tlm_demo3.
+// -----------------------------------------------------------------------------
+co_task<void> processor1::program_main()
+{
+    uint32_t byte_en = 0x000000FF;    // byte enable ptr
+    uint32_t addr    = 0xFF000000;    // address to read from the memory
+    
+    co_await delay(25_ns); // wait until the first data writtten into memory
+
+    
+    while(true)
+    {
+        uint32_t rdata = co_await bus.read(addr++, byte_en);
+        
+        if(bus.response_ok())
+        {
+            if (verbose)
+                cout << "     (cpu1) @ " << sc_time_stamp() << ", Read Succeeded.\n";
+            co_await process_data (rdata);
+        }else{
+            if (verbose)
+                cout << "     (cpu1) @ " << sc_time_stamp() << ", Read Failed.\n";
+        }
+    }
+}
+
+
+// -----------------------------------------------------------------------------
+// The funtion simulates the instructions execution to process the received data
+// before write to the memory by increment of program counter (PC). Assume
+// the data prepare program starts from address 0x00000200 in the memory, and
+// further assume that it executes 10 instructions to prepare a full- word data.
+// -----------------------------------------------------------------------------
+co_task<void> processor1::process_data (uint32_t data)
+{
+    if (verbose)
+    {
+        cout << "(cpu1)      @ " << sc_time_stamp();
+        cout << ", data received = 0x";
+        cout <<  setw(2) << setfill('0') << hex << uppercase << data << endl;
+    }
+    
+    for (uint32_t pc = 0x00000200; pc<0x00000228; pc+=4)
+    {
+        if (verbose)
+        {
+            // debug print to track the program counter
+            cout << "(cpu1)      @ " << sc_time_stamp();
+            cout << ", processing received data, PC = 0x";
+            cout <<  setw(4) << setfill('0') << hex << uppercase << pc << endl;
+        }
+        
+        co_await delay(2_ns); // wait for the instruction delay
+    }
+    
+    if (verbose)
+    {
+        cout << "(cpu1)      @ " << sc_time_stamp();
+        cout << ", data processing complete.\n" << endl;
+    }
+}
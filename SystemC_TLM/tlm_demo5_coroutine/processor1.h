@@ -0,0 +1,43 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/processor1.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Processor1 module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo5_coroutine_processor1_h_
+#define _tlm_demo5_coroutine_processor1_h_
+
+#include "co_initiator.h"
+
+//------------------------------------------------------------------------------
+// Consumer processor1 of tlm_demo3 written as a coroutine program.
+//------------------------------------------------------------------------------
+class processor1 : public  co_initiator
+{
+public:
+    
+    //! Class Construct
+    processor1(sc_core::sc_module_name  name, bool verbose = true);
+    
+
+    
+private:
+    
+    //! Coroutine running the consumer program.
+    co_task<void> program_main();
+    
+    // function to simulate the data processing program
+    co_task<void> process_data (uint32_t data);
+    
+    //! Print the program trace on the console.
+    bool verbose;
+    
+};
+
+#endif
@@ -0,0 +1,80 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo5_coroutine/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo5 (coroutine based initiators)
+ *
+ * Usage: tlm_demo5_coroutine [number of core pairs] [time in ns]
+ *
+ * With a single producer/consumer pair the program trace is printed, with more
+ * pairs the console output is disabled and only the performance is reported.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include <sstream>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "co_scheduler.h"
+#include "processor0.h"
+#include "processor1.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo5
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    int     n_pairs = (argc > 1) ? atoi(argv[1]) : 1;
+    double  t_sim   = (argc > 2) ? atof(argv[2]) : 100;  // in nano second
+    bool    verbose = (n_pairs == 1);
+    
+    //! The scheduler resuming all coroutine programs
+    co_scheduler *i_sched = new co_scheduler("i_scheduler");
+    
+    //! Instantiate and bind the modules
+    for (int i = 0; i < n_pairs; i++)
+    {
+        ostringstream id;
+        id << i;
+        
+        processor0 *i_cpu0 = new processor0(("i_cpu0_" + id.str()).c_str(), verbose);
+        processor1 *i_cpu1 = new processor1(("i_cpu1_" + id.str()).c_str(), verbose);
+        memory     *i_mem  = new memory(("i_memory_" + id.str()).c_str(), verbose);
+        bus        *i_bus  = new bus(("i_bus_" + id.str()).c_str());
+        
+        i_cpu0->data_bus.bind( i_bus->data_bus0 );
+        i_cpu1->data_bus.bind( i_bus->data_bus1 );
+        i_bus->initiator_socket.bind(i_mem->data_bus);
+    }
+    
+    int t_start=clock();
+    sc_start(t_sim, sc_core::SC_NS);
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    
+    co_arena &arena = co_arena::instance();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 5(coroutine): Simulation Complete#" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Core pairs       : " << setw(10) << setfill(' ') << n_pairs   <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim     <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "# Task resumptions : " << setw(10) << setfill(' ') << i_sched->get_resume_count() <<"             #"<< endl;
+    cout << "# Frame bytes/core : " << setw(10) << setfill(' ') << arena.get_bytes_peak()/(2*n_pairs) <<"             #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
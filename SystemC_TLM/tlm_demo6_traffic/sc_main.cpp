@@ -0,0 +1,93 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo6_traffic/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo6 (synthetic traffic)
+ *
+ * Usage: tlm_demo6_traffic [sequential|strided|random|hotspot|mix]
+ *                          [transactions per generator] [outstanding depth]
+ *
+ * Two traffic generators load the bus and the memory of tlm_demo3. The memory
+ * logging is disabled, so the host throughput of the interconnect and the
+ * target is measured.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "traffic_generator.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo6
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    string pattern = (argc > 1) ? argv[1] : "random";
+    
+    traffic_config config;
+    config.pattern        = (pattern == "sequential") ? PATTERN_SEQUENTIAL :
+                            (pattern == "strided")    ? PATTERN_STRIDED    :
+                            (pattern == "hotspot")    ? PATTERN_HOTSPOT    :
+                            (pattern == "mix")        ? PATTERN_TRACE_MIX  :
+                                                        PATTERN_RANDOM;
+    config.base_addr      = 0xFF000000;
+    config.range          = 256;
+    config.stride         = 16;
+    config.read_ratio     = 0.7;
+    config.access_size    = 4;
+    config.burst_length   = 4;
+    config.issue_interval = sc_core::sc_time(1, sc_core::SC_NS);
+    config.n_transactions = (argc > 2) ? atoll(argv[2]) : 1000000;
+    config.outstanding    = (argc > 3) ? atoi(argv[3])  : 4;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    //! Instantiate the modules
+    traffic_generator *i_gen0 = new traffic_generator("i_gen0", config);
+    config.seed = 2;
+    traffic_generator *i_gen1 = new traffic_generator("i_gen1", config);
+    memory            *i_mem  = new memory("i_memory", false);
+    bus               *i_bus  = new bus("i_bus");
+    
+    //! Bind  the TLM ports
+    i_gen0->data_bus.bind( i_bus->data_bus0 );
+    i_gen1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    uint64_t n_trans  = i_gen0->get_transactions() + i_gen1->get_transactions();
+    uint64_t n_errors = i_gen0->get_errors() + i_gen1->get_errors();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 6(traffic): Simulation Complete. #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Transactions     : " << setw(10) << setfill(' ') << n_trans   <<"             #"<<endl;
+    cout << "# Error responses  : " << setw(10) << setfill(' ') << n_errors  <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e9 <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "# Transactions/s   : " << setw(10) << setfill(' ') << n_trans/t_cpu <<" (host)      #"<< endl;
+    cout << "# Transactions/us  : " << setw(10) << setfill(' ') << n_trans/(t_sim*1e6) <<" (simulated) #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
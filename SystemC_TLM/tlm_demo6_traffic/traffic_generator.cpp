@@ -0,0 +1,204 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo6_traffic/traffic_generator.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Synthetic traffic generator module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include "traffic_generator.h"
+
+SC_HAS_PROCESS( traffic_generator );
+
+using namespace std;
+using namespace sc_core;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the traffic_generator module
+//
+//! @param name        SystemC module name
+//! @param config      The traffic configuration
+//------------------------------------------------------------------------------
+traffic_generator::traffic_generator(sc_module_name         name,
+                                     const traffic_config&  config):
+sc_module (name),
+data_bus("data_bus"),
+config(config),
+data(config.access_size),
+rng(config.seed ? config.seed : 1),
+seq_offset(0),
+stride_offset(0),
+n_issued(0),
+n_reads(0),
+n_errors(0),
+n_bytes(0)
+{
+    if (this->config.access_size == 0)  this->config.access_size  = 4;
+    if (this->config.burst_length == 0) this->config.burst_length = 1;
+    if (this->config.outstanding == 0)  this->config.outstanding  = 1;
+    if (this->config.range < this->config.access_size)
+    {
+        this->config.range = this->config.access_size;
+    }
+    data.resize(this->config.access_size);
+    
+    // write data pattern, reused by all write accesses
+    for (size_t i = 0; i < data.size(); i++) data[i] = random() & 0xFF;
+    
+    q_keeper.reset();    // Zero local time offset
+    
+    //! Attaches the transaction tags to the payload, once for all transactions.
+    tags = txn_attach(trans, this, this->config.qos);
+    
+    //! Defines the function ::program_main() as a SystemC thread.
+    SC_THREAD (program_main);
+}
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread issuing the configured traffic.
+// -----------------------------------------------------------------------------
+void traffic_generator::program_main()
+{
+    const unsigned int depth = config.outstanding;
+    const unsigned int size  = config.access_size;
+    
+    in_flight.assign(depth, SC_ZERO_TIME);
+    unsigned int head  = 0;   // oldest access in flight
+    unsigned int count = 0;   // number of accesses in flight
+    
+    sc_time  t_issue = sc_time_stamp();   // earliest issue time of next access
+    uint64_t offset  = 0;                 // offset of the current burst
+    unsigned int beat = 0;                // beat in the current burst
+    
+    while (config.n_transactions == 0 || n_issued < config.n_transactions)
+    {
+        // the oldest access retires when the maximum depth is in flight
+        if (count == depth)
+        {
+            if (in_flight[head] > t_issue) t_issue = in_flight[head];
+            head = (head + 1) % depth;
+            count--;
+        }
+        
+        // use td instead of wait to advance to the issue time
+        q_keeper.set( t_issue - sc_time_stamp() );
+        if( q_keeper.need_sync() ) { q_keeper.sync(); } // Sync if needed
+        
+        if (beat == 0) offset = next_burst_offset();
+        uint64_t addr = config.base_addr + (offset + beat * size) % config.range;
+        if (++beat == config.burst_length) beat = 0;
+        
+        tlm::tlm_command cmd = (random_unit() < config.read_ratio) ?
+                               tlm::TLM_READ_COMMAND : tlm::TLM_WRITE_COMMAND;
+        
+        // Initialize 8 out of the 10 attributes, byte_enable_length being
+        // unused, the extensions are the transaction tags
+        trans.set_command(cmd);
+        trans.set_address(addr);
+        trans.set_data_ptr(&data[0]);
+        trans.set_data_length(size);
+        trans.set_streaming_width(size);//=data_length indicates no streaming
+        trans.set_byte_enable_ptr(0);
+        trans.set_dmi_allowed(false);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        
+        // Blocking transport call at the local issue time
+        sc_time delay = q_keeper.get_local_time();
+        txn_stamp(tags, delay);
+        data_bus->b_transport(trans, delay);
+        
+        // the access is in flight until the annotated completion time
+        in_flight[(head + count) % depth] = sc_time_stamp() + delay;
+        count++;
+        t_issue += config.issue_interval;
+        
+        n_issued++;
+        n_bytes += size;
+        if (cmd == tlm::TLM_READ_COMMAND) n_reads++;
+        if (!trans.is_response_ok())      n_errors++;
+        
+        if (config.verbose)
+        {
+            cout << "(" << name() << ") @ " << sc_time_stamp() + q_keeper.get_local_time();
+            cout << (cmd == tlm::TLM_READ_COMMAND ? ", Read  " : ", Write ");
+            cout << dec << size << " bytes at 0x" << setw(8) << setfill('0');
+            cout << hex << uppercase << addr << ", " << trans.get_response_string();
+            cout << dec << endl;
+        }
+    }
+    
+    // wait for the accesses in flight to complete
+    sc_time t_end = t_issue;
+    for (unsigned int i = 0; i < count; i++)
+    {
+        if (in_flight[(head + i) % depth] > t_end) t_end = in_flight[(head + i) % depth];
+    }
+    q_keeper.set( t_end - sc_time_stamp() );
+    q_keeper.sync();
+    
+    done.notify();
+}
+
+
+// -----------------------------------------------------------------------------
+//! Returns the offset of the next burst in the address range.
+// -----------------------------------------------------------------------------
+uint64_t traffic_generator::next_burst_offset()
+{
+    if (config.pattern != PATTERN_TRACE_MIX) return pattern_offset(config.pattern);
+    
+    // weighted choice of one of the basic patterns
+    double total = 0;
+    for (int i = 0; i < 4; i++) total += config.mix_weight[i];
+    
+    double pick = random_unit() * total;
+    for (int i = 0; i < 3; i++)
+    {
+        if (pick < config.mix_weight[i]) return pattern_offset(traffic_pattern(i));
+        pick -= config.mix_weight[i];
+    }
+    return pattern_offset(PATTERN_HOTSPOT);
+}
+
+
+// -----------------------------------------------------------------------------
+//! Returns the offset of the next burst for one of the basic patterns.
+//
+//! @param p  The address pattern
+// -----------------------------------------------------------------------------
+uint64_t traffic_generator::pattern_offset(traffic_pattern p)
+{
+    const uint64_t size  = config.access_size;
+    uint64_t       slots = config.range / size;
+    uint64_t       o     = 0;
+    
+    switch (p)
+    {
+        case PATTERN_SEQUENTIAL:
+            o = seq_offset;
+            seq_offset = (seq_offset + size * config.burst_length) % config.range;
+            break;
+        case PATTERN_STRIDED:
+            o = stride_offset;
+            stride_offset = (stride_offset + config.stride) % config.range;
+            break;
+        case PATTERN_HOTSPOT:
+            if (random_unit() < config.hot_ratio && config.hot_size >= size)
+            {
+                o = config.hot_base + (random() % (config.hot_size / size)) * size;
+                break;
+            }
+            // fall through
+        case PATTERN_RANDOM:
+        default:
+            o = (random() % slots) * size;
+            break;
+    }
+    return o;
+}
@@ -0,0 +1,164 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo6_traffic/traffic_generator.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Synthetic traffic generator module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo6_traffic_generator_h_
+#define _tlm_demo6_traffic_generator_h_
+
+#include <iomanip>
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "../tlm_demo2/txn_extensions.h"
+
+
+//------------------------------------------------------------------------------
+//! Address patterns of the traffic generator.
+//------------------------------------------------------------------------------
+enum traffic_pattern
+{
+    PATTERN_SEQUENTIAL,     //!< consecutive accesses through the range
+    PATTERN_STRIDED,        //!< accesses with a fixed stride through the range
+    PATTERN_RANDOM,         //!< uniformly distributed accesses in the range
+    PATTERN_HOTSPOT,        //!< random accesses, a share of them in a hot window
+    PATTERN_TRACE_MIX       //!< per burst one of the patterns above, weighted
+};
+
+//------------------------------------------------------------------------------
+//! Configuration of the traffic generator.
+//------------------------------------------------------------------------------
+struct traffic_config
+{
+    traffic_pattern   pattern;          //!< address pattern
+    uint64_t          base_addr;        //!< first address of the range
+    uint64_t          range;            //!< size of the address range in bytes
+    uint64_t          stride;           //!< stride of PATTERN_STRIDED in bytes
+    uint64_t          hot_base;         //!< offset of the hot window in the range
+    uint64_t          hot_size;         //!< size of the hot window in bytes
+    double            hot_ratio;        //!< share of accesses to the hot window
+    double            mix_weight[4];    //!< weights of the patterns for TRACE_MIX
+    double            read_ratio;       //!< share of read accesses
+    unsigned int      access_size;      //!< bytes per access
+    unsigned int      burst_length;     //!< consecutive accesses per burst
+    sc_core::sc_time  issue_interval;   //!< minimum time between two issues
+    unsigned int      outstanding;      //!< maximum accesses in flight
+    uint64_t          n_transactions;   //!< accesses to issue, zero is unlimited
+    uint64_t          seed;             //!< seed of the random generator
+    uint8_t           qos;              //!< quality of service class
+    bool              verbose;          //!< print every access on the console
+    
+    //! Default configuration, sequential 4-byte reads and writes
+    traffic_config()
+    : pattern(PATTERN_SEQUENTIAL), base_addr(0), range(256), stride(64),
+      hot_base(0), hot_size(64), hot_ratio(0.9), read_ratio(0.5),
+      access_size(4), burst_length(1), issue_interval(sc_core::SC_ZERO_TIME),
+      outstanding(1), n_transactions(0), seed(1), qos(0), verbose(false)
+    {
+        mix_weight[0] = mix_weight[1] = mix_weight[2] = mix_weight[3] = 1.0;
+    }
+};
+
+
+//------------------------------------------------------------------------------
+//! Synthetic traffic generator.
+//
+//! Issues blocking transactions following a configurable pattern. The module
+//! uses temporal decoupling with the global quantum: accesses are issued in
+//! local time and the thread only synchronizes at the quantum boundaries, so
+//! the throughput of the interconnect and the target can be characterized
+//! independently of the processor models. The outstanding depth is modelled
+//! arithmetically: an access is issued when the oldest of the accesses in
+//! flight has completed in local time.
+//------------------------------------------------------------------------------
+class traffic_generator : public sc_core::sc_module
+{
+public:
+    
+    //! Class Construct
+    traffic_generator(sc_core::sc_module_name  name,
+                      const traffic_config&    config);
+    
+    // TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<traffic_generator> data_bus;
+    
+    //! Number of issued accesses.
+    uint64_t get_transactions() const { return n_issued; }
+    
+    //! Number of issued read accesses.
+    uint64_t get_reads() const { return n_reads; }
+    
+    //! Number of accesses answered with an error response.
+    uint64_t get_errors() const { return n_errors; }
+    
+    //! Number of transferred bytes.
+    uint64_t get_bytes() const { return n_bytes; }
+    
+    //! Notified when all accesses are issued and completed.
+    sc_core::sc_event done;
+    
+private:
+    
+    //! SystemC Thread issuing the traffic.
+    void program_main();
+    
+    //! Start address of the next burst.
+    uint64_t next_burst_offset();
+    
+    //! Offset for one pattern.
+    uint64_t pattern_offset(traffic_pattern p);
+    
+    //! Random number, xorshift64*.
+    uint64_t random()
+    {
+        rng ^= rng >> 12;
+        rng ^= rng << 25;
+        rng ^= rng >> 27;
+        return rng * 2685821657736338717ULL;
+    }
+    
+    //! Random number in [0, 1).
+    double random_unit() { return (random() >> 11) * (1.0 / 9007199254740992.0); }
+    
+    //! Configuration.
+    traffic_config  config;
+    
+    //! The generic payload.
+    tlm::tlm_generic_payload  trans;
+    
+    //! The transaction tags attached to ::trans.
+    txn_tags  tags;
+    
+    //! Data buffer of one access.
+    std::vector<uint8_t>  data;
+    
+    //! Completion times of the accesses in flight, oldest first.
+    std::vector<sc_core::sc_time>  in_flight;
+    
+    //! Quantum keeper for the local time offset.
+    tlm_utils::tlm_quantumkeeper  q_keeper;
+    
+    //! State of the random generator.
+    uint64_t  rng;
+    
+    //! Offset of the next access of the sequential patterns.
+    uint64_t  seq_offset;
+    uint64_t  stride_offset;
+    
+    //! Statistics.
+    uint64_t  n_issued;
+    uint64_t  n_reads;
+    uint64_t  n_errors;
+    uint64_t  n_bytes;
+};
+
+#endif
@@ -0,0 +1,110 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo7 (transaction record and replay)
+ *
+ * Usage: tlm_demo7_trace record [transactions per initiator]
+ *        tlm_demo7_trace replay [time scale]
+ *
+ * The record run drives the bus and the memory with two traffic generators of
+ * tlm_demo6 and records their transactions into trace0.vptr and trace1.vptr.
+ * The replay run re-issues both traces against the same bus and memory.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+#include "trace_recorder.h"
+#include "trace_replay.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo7
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    bool record = (argc < 2) || (string(argv[1]) != "replay");
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    memory  *i_mem = new memory("i_memory", false);
+    bus     *i_bus = new bus("i_bus");
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    trace_replay *i_replay0 = 0;
+    trace_replay *i_replay1 = 0;
+    
+    if (record)
+    {
+        traffic_config config;
+        config.pattern        = PATTERN_TRACE_MIX;
+        config.base_addr      = 0xFF000000;
+        config.range          = 256;
+        config.burst_length   = 4;
+        config.issue_interval = sc_core::sc_time(1, sc_core::SC_NS);
+        config.n_transactions = (argc > 2) ? atoll(argv[2]) : 1000000;
+        
+        //! Instantiate the initiators and recorders
+        traffic_generator *i_gen0 = new traffic_generator("i_gen0", config);
+        config.seed = 2;
+        traffic_generator *i_gen1 = new traffic_generator("i_gen1", config);
+        trace_recorder    *i_rec0 = new trace_recorder("i_rec0", "trace0.vptr");
+        trace_recorder    *i_rec1 = new trace_recorder("i_rec1", "trace1.vptr");
+        
+        //! Bind  the TLM ports
+        i_gen0->data_bus.bind( i_rec0->target_socket );
+        i_gen1->data_bus.bind( i_rec1->target_socket );
+        i_rec0->initiator_socket.bind( i_bus->data_bus0 );
+        i_rec1->initiator_socket.bind( i_bus->data_bus1 );
+    }
+    else
+    {
+        double time_scale = (argc > 2) ? atof(argv[2]) : 1.0;
+        
+        //! Instantiate the replay initiators
+        i_replay0 = new trace_replay("i_replay0", "trace0.vptr", time_scale);
+        i_replay1 = new trace_replay("i_replay1", "trace1.vptr", time_scale);
+        
+        //! Bind  the TLM ports
+        i_replay0->data_bus.bind( i_bus->data_bus0 );
+        i_replay1->data_bus.bind( i_bus->data_bus1 );
+    }
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 7(" << (record ? "record" : "replay") << "): Simulation Complete.  #" << endl;
+    cout << "#                                           #" << endl;
+    if (!record)
+    {
+        cout << "# Transactions     : " << setw(10) << setfill(' ');
+        cout << i_replay0->get_transactions() + i_replay1->get_transactions() <<"             #"<<endl;
+        cout << "# Read mismatches  : " << setw(10) << setfill(' ');
+        cout << i_replay0->get_mismatches() + i_replay1->get_mismatches() <<"             #"<<endl;
+    }
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e9 <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,225 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/trace_file.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Transaction trace file writer and reader implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "trace_file.h"
+
+using namespace std;
+using namespace sc_core;
+
+//! File magic and format version.
+static const char     TRACE_MAGIC[4] = { 'V', 'P', 'T', 'R' };
+static const uint32_t TRACE_VERSION  = 1;
+
+//! Flags of a record.
+static const uint8_t  FLAG_CMD_MASK  = 0x03;
+static const uint8_t  FLAG_LENGTH    = 0x04;
+static const uint8_t  FLAG_BYTE_EN   = 0x08;
+
+//! Size of the encoding buffer written at once.
+static const size_t   BUFFER_SIZE    = 1 << 20;
+
+//! Size of the file header.
+static const size_t   HEADER_SIZE    = 16;
+
+//! Zigzag encoding of a signed difference.
+static inline sc_dt::uint64 zigzag(sc_dt::uint64 a, sc_dt::uint64 b)
+{
+    sc_dt::int64 d = sc_dt::int64(a - b);
+    return (sc_dt::uint64(d) << 1) ^ sc_dt::uint64(d >> 63);
+}
+
+//! Inverse of zigzag(), returns b + d.
+static inline sc_dt::uint64 unzigzag(sc_dt::uint64 b, sc_dt::uint64 z)
+{
+    return b + ((z >> 1) ^ (~(z & 1) + 1));
+}
+
+
+//------------------------------------------------------------------------------
+//! Creates the trace file and writes the header.
+//
+//! @param file_name  Name of the trace file
+//------------------------------------------------------------------------------
+trace_writer::trace_writer(const string& file_name) :
+last_time(0), last_addr(0), last_length(0), n_records(0)
+{
+    file = fopen(file_name.c_str(), "wb");
+    if (file == 0)
+    {
+        SC_REPORT_ERROR("trace_writer", ("can not create " + file_name).c_str());
+        return;
+    }
+    
+    buffer.reserve(BUFFER_SIZE + 4096);
+    
+    sc_dt::uint64 resolution_fs =
+        sc_dt::uint64(sc_get_time_resolution().to_seconds() * 1e15 + 0.5);
+    
+    buffer.insert(buffer.end(), TRACE_MAGIC, TRACE_MAGIC + 4);
+    for (int i = 0; i < 4; i++) buffer.push_back(uint8_t(TRACE_VERSION >> (8 * i)));
+    for (int i = 0; i < 8; i++) buffer.push_back(uint8_t(resolution_fs >> (8 * i)));
+}
+
+
+//------------------------------------------------------------------------------
+//! Flushes the remaining records and closes the trace file.
+//------------------------------------------------------------------------------
+trace_writer::~trace_writer()
+{
+    if (file == 0) return;
+    flush();
+    fclose(file);
+}
+
+
+//------------------------------------------------------------------------------
+//! Appends one record to the trace.
+//
+//! @param r  The record
+//------------------------------------------------------------------------------
+void trace_writer::write(const trace_record& r)
+{
+    uint8_t flags = uint8_t(r.cmd) & FLAG_CMD_MASK;
+    if (r.length != last_length) flags |= FLAG_LENGTH;
+    if (r.be_length != 0)        flags |= FLAG_BYTE_EN;
+    
+    buffer.push_back(flags);
+    put_varint(zigzag(r.time, last_time));
+    put_varint(zigzag(r.addr, last_addr));
+    if (flags & FLAG_LENGTH) put_varint(r.length);
+    if (r.cmd != tlm::TLM_IGNORE_COMMAND)
+    {
+        buffer.insert(buffer.end(), r.data, r.data + r.length);
+    }
+    if (flags & FLAG_BYTE_EN)
+    {
+        put_varint(r.be_length);
+        buffer.insert(buffer.end(), r.be, r.be + r.be_length);
+    }
+    
+    last_time   = r.time;
+    last_addr   = r.addr;
+    last_length = r.length;
+    n_records++;
+    
+    if (buffer.size() >= BUFFER_SIZE) flush();
+}
+
+
+//------------------------------------------------------------------------------
+//! Writes the encoded records to the file.
+//------------------------------------------------------------------------------
+void trace_writer::flush()
+{
+    if (file == 0 || buffer.empty()) return;
+    fwrite(&buffer[0], 1, buffer.size(), file);
+    buffer.clear();
+}
+
+
+//------------------------------------------------------------------------------
+//! Maps the trace file and checks the header.
+//
+//! @param file_name  Name of the trace file
+//------------------------------------------------------------------------------
+trace_reader::trace_reader(const string& file_name) :
+base(0), size(0), pos(0), resolution_fs(0),
+last_time(0), last_addr(0), last_length(0)
+{
+    int fd = open(file_name.c_str(), O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || size_t(st.st_size) < HEADER_SIZE)
+    {
+        if (fd >= 0) close(fd);
+        SC_REPORT_ERROR("trace_reader", ("can not open " + file_name).c_str());
+        return;
+    }
+    
+    // copy-on-write mapping, targets may modify the data of write commands
+    void* p = mmap(0, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED)
+    {
+        SC_REPORT_ERROR("trace_reader", ("can not map " + file_name).c_str());
+        return;
+    }
+    madvise(p, st.st_size, MADV_SEQUENTIAL);
+    
+    base = static_cast<unsigned char*>(p);
+    size = st.st_size;
+    
+    uint32_t version = 0;
+    for (int i = 0; i < 4; i++) version       |= uint32_t(base[4 + i]) << (8 * i);
+    for (int i = 0; i < 8; i++) resolution_fs |= sc_dt::uint64(base[8 + i]) << (8 * i);
+    
+    if (memcmp(base, TRACE_MAGIC, 4) != 0 || version != TRACE_VERSION)
+    {
+        SC_REPORT_ERROR("trace_reader", (file_name + " is no trace file").c_str());
+        pos = size;
+        return;
+    }
+    pos = HEADER_SIZE;
+}
+
+
+//------------------------------------------------------------------------------
+//! Unmaps the trace file.
+//------------------------------------------------------------------------------
+trace_reader::~trace_reader()
+{
+    if (base != 0) munmap(base, size);
+}
+
+
+//------------------------------------------------------------------------------
+//! Decodes the next record.
+//
+//! @param r  The decoded record, data pointers point into the mapping
+//
+//! @return  False at the end of the trace or on a truncated record.
+//------------------------------------------------------------------------------
+bool trace_reader::read(trace_record& r)
+{
+    if (pos >= size) return false;
+    
+    uint8_t flags = base[pos++];
+    r.cmd  = tlm::tlm_command(flags & FLAG_CMD_MASK);
+    r.time = last_time = unzigzag(last_time, get_varint());
+    r.addr = last_addr = unzigzag(last_addr, get_varint());
+    if (flags & FLAG_LENGTH) last_length = get_varint();
+    r.length = last_length;
+    
+    r.data = 0;
+    if (r.cmd != tlm::TLM_IGNORE_COMMAND)
+    {
+        if (pos + r.length > size) return false;
+        r.data = base + pos;
+        pos   += r.length;
+    }
+    
+    r.be_length = 0;
+    r.be        = 0;
+    if (flags & FLAG_BYTE_EN)
+    {
+        r.be_length = get_varint();
+        if (pos + r.be_length > size) return false;
+        r.be  = base + pos;
+        pos  += r.be_length;
+    }
+    return true;
+}
@@ -0,0 +1,151 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/trace_file.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Transaction trace file writer and reader
+ *
+ * File layout:
+ *   header : magic "VPTR", version (4 bytes), time resolution in fs (8 bytes)
+ *   record : flags byte
+ *            zigzag    issue time delta to the previous record (resolution units)
+ *            zigzag    address delta to the previous record
+ *            varint    data length       (only if it differs from the previous)
+ *            bytes     data              (data length bytes)
+ *            varint    byte enable length, bytes  (only if byte enables used)
+ *   flags  : bits 0-1 command, bit 2 new data length, bit 3 byte enables
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo7_trace_file_h_
+#define _tlm_demo7_trace_file_h_
+
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+
+
+//------------------------------------------------------------------------------
+//! One recorded transaction.
+//------------------------------------------------------------------------------
+struct trace_record
+{
+    tlm::tlm_command  cmd;          //!< command of the transaction
+    sc_dt::uint64     time;         //!< issue time in time resolution units
+    sc_dt::uint64     addr;         //!< address
+    unsigned int      length;       //!< data length
+    unsigned char*    data;         //!< data, read data for read commands
+    unsigned int      be_length;    //!< byte enable length, zero if unused
+    unsigned char*    be;           //!< byte enables
+};
+
+
+//------------------------------------------------------------------------------
+//! Delta encoding writer of a trace file.
+//
+//! Records are encoded into a memory buffer, which is written to the file in
+//! large blocks.
+//------------------------------------------------------------------------------
+class trace_writer
+{
+public:
+    
+    //! Creates the trace file.
+    trace_writer(const std::string& file_name);
+    
+    //! Flushes and closes the trace file.
+    ~trace_writer();
+    
+    //! Appends one record.
+    void write(const trace_record& r);
+    
+    //! Writes the buffered records to the file.
+    void flush();
+    
+    //! Number of records written.
+    sc_dt::uint64 get_records() const { return n_records; }
+    
+private:
+    
+    //! Appends an unsigned LEB128 number.
+    void put_varint(sc_dt::uint64 v)
+    {
+        while (v >= 0x80) { buffer.push_back(uint8_t(v) | 0x80); v >>= 7; }
+        buffer.push_back(uint8_t(v));
+    }
+    
+    //! The trace file.
+    FILE* file;
+    
+    //! Encoded records not yet written.
+    std::vector<uint8_t> buffer;
+    
+    //! Issue time, address and length of the previous record.
+    sc_dt::uint64 last_time;
+    sc_dt::uint64 last_addr;
+    unsigned int  last_length;
+    
+    //! Number of records written.
+    sc_dt::uint64 n_records;
+};
+
+
+//------------------------------------------------------------------------------
+//! Reader of a trace file mapped into memory.
+//
+//! The file is mapped copy-on-write, so the data and byte enable pointers of
+//! the returned records point directly into the mapping.
+//------------------------------------------------------------------------------
+class trace_reader
+{
+public:
+    
+    //! Maps the trace file.
+    trace_reader(const std::string& file_name);
+    
+    //! Unmaps the trace file.
+    ~trace_reader();
+    
+    //! Decodes the next record, returns false at the end of the file.
+    bool read(trace_record& r);
+    
+    //! Time resolution of the recording in fs.
+    sc_dt::uint64 get_resolution_fs() const { return resolution_fs; }
+    
+private:
+    
+    //! Decodes an unsigned LEB128 number.
+    sc_dt::uint64 get_varint()
+    {
+        sc_dt::uint64 v = 0;
+        for (int shift = 0; pos < size; shift += 7)
+        {
+            uint8_t b = base[pos++];
+            v |= sc_dt::uint64(b & 0x7F) << shift;
+            if (!(b & 0x80)) break;
+        }
+        return v;
+    }
+    
+    //! Start and size of the mapping.
+    unsigned char* base;
+    size_t         size;
+    
+    //! Read position in the mapping.
+    size_t         pos;
+    
+    //! Time resolution of the recording in fs.
+    sc_dt::uint64  resolution_fs;
+    
+    //! Issue time, address and length of the previous record.
+    sc_dt::uint64 last_time;
+    sc_dt::uint64 last_addr;
+    unsigned int  last_length;
+};
+
+#endif
@@ -0,0 +1,166 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/trace_recorder.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Transaction recorder module definition and implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo7_trace_recorder_h_
+#define _tlm_demo7_trace_recorder_h_
+
+
+#include <systemc>
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/simple_target_socket.h"
+#include "../tlm_demo2/sg_extension.h"
+#include "trace_file.h"
+
+// ----------------------------------------------------------------------------
+//! Transaction recorder.
+//
+//! Placed between an initiator and the bus, it forwards every transaction and
+//! appends it to a trace file. The issue time is the SystemC time plus the
+//! local time offset of the initiator. Read data is recorded after the
+//! transport, so the replay can check it.
+//
+//! A scatter-gather transaction is recorded as one record per segment, all
+//! with the issue time of the carrier. Debug transport and DMI requests are
+//! forwarded but not recorded, an initiator accessing the memory over a DMI
+//! pointer bypasses the recorder.
+// ----------------------------------------------------------------------------
+class trace_recorder : public sc_core::sc_module
+{
+public:
+    //! @brief The TLM target socket to receive the initiator traffic.
+    tlm_utils::simple_target_socket<trace_recorder>     target_socket;
+    
+    //! @brief The TLM initiator socket to forward the traffic to the bus.
+    tlm_utils::simple_initiator_socket<trace_recorder>  initiator_socket;
+    
+    // -------------------------------------------------------------------------
+    //! Custom Constructor for the recorder.
+    //
+    //! @param name       The SystemC module name
+    //! @param file_name  Name of the trace file to create
+    // -------------------------------------------------------------------------
+    trace_recorder(sc_core::sc_module_name name, const std::string& file_name)
+    : sc_module(name), target_socket("target_socket"),
+      initiator_socket("initiator_socket"), writer(file_name)
+    {
+        // Register callbacks for incoming interface method calls
+        target_socket.register_b_transport(this, &trace_recorder::b_transport);
+        target_socket.register_transport_dbg(this, &trace_recorder::transport_dbg);
+        target_socket.register_get_direct_mem_ptr(this, &trace_recorder::get_direct_mem_ptr);
+        
+        // Register the callback for the DMI invalidation from the bus
+        initiator_socket.register_invalidate_direct_mem_ptr(
+            this, &trace_recorder::invalidate_direct_mem_ptr);
+    }
+    
+    //! Number of recorded transactions.
+    sc_dt::uint64 get_records() const { return writer.get_records(); }
+    
+private:
+    
+    // -------------------------------------------------------------------------
+    //! TLM2.0 blocking transport routine for the target socket
+    //
+    //! Forwards the transaction and records it. A scatter-gather carrier the
+    //! bus did not execute is not recorded, the initiator then sends its
+    //! segments one by one and each of them is recorded.
+    //
+    //! @param trans  The transaction payload
+    //! @param delay  How far the initiator is beyond baseline SystemC time.
+    // -------------------------------------------------------------------------
+    void b_transport( tlm::tlm_generic_payload& trans, sc_core::sc_time& delay )
+    {
+        sc_core::sc_time issue = sc_core::sc_time_stamp() + delay;
+        
+        initiator_socket->b_transport( trans, delay );
+        
+        sg_extension* sg = 0;
+        trans.get_extension(sg);
+        if (sg != 0)
+        {
+            if (!sg->executed) return;
+            
+            for (size_t i = 0; i < sg->segments.size(); i++)
+            {
+                const sg_segment& seg = sg->segments[i];
+                record(sg->command, issue, seg.addr, seg.length, seg.data,
+                       seg.byte_en ? seg.length : 0, seg.byte_en);
+            }
+            return;
+        }
+        
+        // the processors of the tutorials leave the byte enable length unset
+        // and use one byte enable per data byte
+        unsigned int be_length = 0;
+        if (trans.get_byte_enable_ptr() != 0)
+        {
+            be_length = trans.get_byte_enable_length();
+            if (be_length == 0) be_length = trans.get_data_length();
+        }
+        record(trans.get_command(), issue, trans.get_address(),
+               trans.get_data_length(), trans.get_data_ptr(),
+               be_length, trans.get_byte_enable_ptr());
+    }
+    
+    // -------------------------------------------------------------------------
+    //! Appends one record to the trace file.
+    // -------------------------------------------------------------------------
+    void record( tlm::tlm_command cmd, const sc_core::sc_time& issue,
+                 sc_dt::uint64 addr, unsigned int length, unsigned char* data,
+                 unsigned int be_length, unsigned char* be )
+    {
+        trace_record r;
+        r.cmd       = cmd;
+        r.time      = issue.value();
+        r.addr      = addr;
+        r.length    = length;
+        r.data      = data;
+        r.be_length = be_length;
+        r.be        = be;
+        writer.write(r);
+    }
+    
+    // -------------------------------------------------------------------------
+    //! TLM2.0 debug transport routine for the target socket, not recorded.
+    // -------------------------------------------------------------------------
+    unsigned int transport_dbg( tlm::tlm_generic_payload& trans )
+    {
+        return initiator_socket->transport_dbg( trans );
+    }
+    
+    // -------------------------------------------------------------------------
+    //! TLM2.0 DMI request for the target socket, forwarded to the bus.
+    // -------------------------------------------------------------------------
+    bool get_direct_mem_ptr( tlm::tlm_generic_payload& trans,
+                             tlm::tlm_dmi& dmi_data )
+    {
+        return initiator_socket->get_direct_mem_ptr( trans, dmi_data );
+    }
+    
+    // -------------------------------------------------------------------------
+    //! TLM2.0 DMI invalidation from the bus, passed to the initiator.
+    // -------------------------------------------------------------------------
+    void invalidate_direct_mem_ptr( sc_dt::uint64 start, sc_dt::uint64 end )
+    {
+        target_socket->invalidate_direct_mem_ptr( start, end );
+    }
+    
+    //! Writer of the trace file.
+    trace_writer writer;
+    
+    //! Flushes the trace at the end of simulation.
+    void end_of_simulation() { writer.flush(); }
+};
+
+
+#endif
@@ -0,0 +1,101 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/trace_replay.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Trace replay initiator module implementation
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <cstring>
+#include "trace_replay.h"
+
+SC_HAS_PROCESS( trace_replay );
+
+using namespace std;
+using namespace sc_core;
+
+//------------------------------------------------------------------------------
+//! Class Constructor of the trace_replay module
+//
+//! @param name        SystemC module name
+//! @param file_name   Name of the trace file to replay
+//! @param time_scale  Factor applied to the recorded issue times
+//------------------------------------------------------------------------------
+trace_replay::trace_replay(sc_module_name  name,
+                           const string&   file_name,
+                           double          time_scale):
+sc_module (name),
+data_bus("data_bus"),
+reader(file_name),
+time_scale(time_scale),
+n_replayed(0),
+n_errors(0),
+n_mismatches(0)
+{
+    q_keeper.reset();    // Zero local time offset
+    
+    //! Defines the function ::program_main() as a SystemC thread.
+    SC_THREAD (program_main);
+}
+
+
+// -----------------------------------------------------------------------------
+//! The SystemC thread replaying the trace.
+// -----------------------------------------------------------------------------
+void trace_replay::program_main()
+{
+    // factor from recorded time units to seconds
+    double unit = reader.get_resolution_fs() * 1e-15 * time_scale;
+    
+    trace_record r;
+    while (reader.read(r))
+    {
+        // issue at the scaled recorded time, but not before the previous
+        // transaction has completed
+        sc_time issue = sc_time(double(r.time) * unit, SC_SEC);
+        sc_time now   = q_keeper.get_current_time();
+        if (issue > now) q_keeper.inc(issue - now);
+        if (q_keeper.need_sync()) q_keeper.sync(); // Sync if needed
+        
+        // read data goes to a buffer, the recorded data is the reference
+        unsigned char* data_ptr = r.data;
+        if (r.cmd == tlm::TLM_READ_COMMAND)
+        {
+            if (read_data.size() < r.length) read_data.resize(r.length);
+            data_ptr = &read_data[0];
+        }
+        
+        trans.set_command(r.cmd);
+        trans.set_address(r.addr);
+        trans.set_data_ptr(data_ptr);
+        trans.set_data_length(r.length);
+        trans.set_streaming_width(r.length);//=data_length indicates no streaming
+        trans.set_byte_enable_ptr(r.be);
+        trans.set_byte_enable_length(r.be_length);
+        trans.set_dmi_allowed(false);
+        trans.set_response_status(tlm::TLM_INCOMPLETE_RESPONSE);
+        
+        // Blocking transport call
+        sc_time delay = q_keeper.get_local_time();
+        data_bus->b_transport(trans, delay);
+        
+        // use td instead of wait to update local time
+        q_keeper.set( delay );
+        
+        n_replayed++;
+        if (!trans.is_response_ok()) n_errors++;
+        if (r.cmd == tlm::TLM_READ_COMMAND && r.length != 0 &&
+            memcmp(data_ptr, r.data, r.length) != 0)
+        {
+            n_mismatches++;
+        }
+    }
+    
+    q_keeper.sync();
+    done.notify();
+}
@@ -0,0 +1,85 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo7_trace/trace_replay.h
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Trace replay initiator module definition
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+#ifndef _tlm_demo7_trace_replay_h_
+#define _tlm_demo7_trace_replay_h_
+
+#include <vector>
+#include "systemc"
+#include "tlm.h"
+#include "tlm_utils/simple_initiator_socket.h"
+#include "tlm_utils/tlm_quantumkeeper.h"
+#include "trace_file.h"
+
+
+//------------------------------------------------------------------------------
+//! Initiator re-issuing the transactions of a trace file.
+//
+//! The trace is streamed from the mapped file, write data and byte enables are
+//! passed to the target without copying. Each transaction is issued at its
+//! recorded time multiplied by the time scale: 1.0 keeps the original timing,
+//! smaller values compress it and 0.0 issues the transactions back to back.
+//! A transaction is never issued before the previous one has completed. The
+//! thread synchronizes only at the global quantum, so the replay does not
+//! depend on the scheduling of other processes and is deterministic.
+//------------------------------------------------------------------------------
+class trace_replay : public sc_core::sc_module
+{
+public:
+    
+    //! Class Construct
+    trace_replay(sc_core::sc_module_name  name,
+                 const std::string&       file_name,
+                 double                   time_scale = 1.0);
+    
+    // TLM-2 socket, defaults to 32-bits wide, base protocol
+    tlm_utils::simple_initiator_socket<trace_replay> data_bus;
+    
+    //! Number of replayed transactions.
+    sc_dt::uint64 get_transactions() const { return n_replayed; }
+    
+    //! Number of transactions answered with an error response.
+    sc_dt::uint64 get_errors() const { return n_errors; }
+    
+    //! Number of reads returning other data than recorded.
+    sc_dt::uint64 get_mismatches() const { return n_mismatches; }
+    
+    //! Notified when the trace is replayed completely.
+    sc_core::sc_event done;
+    
+private:
+    
+    //! SystemC Thread replaying the trace.
+    void program_main();
+    
+    //! Reader of the mapped trace file.
+    trace_reader reader;
+    
+    //! Factor applied to the recorded issue times.
+    double time_scale;
+    
+    //! The generic payload.
+    tlm::tlm_generic_payload  trans;
+    
+    //! Buffer for read data.
+    std::vector<unsigned char> read_data;
+    
+    //! Quantum keeper for the local time offset.
+    tlm_utils::tlm_quantumkeeper  q_keeper;
+    
+    //! Statistics.
+    sc_dt::uint64 n_replayed;
+    sc_dt::uint64 n_errors;
+    sc_dt::uint64 n_mismatches;
+};
+
+#endif
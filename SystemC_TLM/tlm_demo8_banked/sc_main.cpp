@@ -0,0 +1,94 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo8_banked/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo8 (banked memory)
+ *
+ * Usage: tlm_demo8_banked [number of banks] [line|page]
+ *                         [sequential|strided|random|hotspot]
+ *
+ * Two traffic generators access the memory with the banked timing policy.
+ * Compare the simulated time and the bank conflicts for different bank
+ * counts, interleaving granularities and access patterns. The quantum is
+ * short, since the generators share the banks while they run ahead of each
+ * other, see banked_timing.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo8
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    unsigned int n_banks = (argc > 1) ? atoi(argv[1]) : 4;
+    string       interleave = (argc > 2) ? argv[2] : "line";
+    string       pattern    = (argc > 3) ? argv[3] : "sequential";
+    
+    traffic_config config;
+    config.pattern        = (pattern == "strided") ? PATTERN_STRIDED :
+                            (pattern == "random")  ? PATTERN_RANDOM  :
+                            (pattern == "hotspot") ? PATTERN_HOTSPOT :
+                                                     PATTERN_SEQUENTIAL;
+    config.base_addr      = 0x00000000;
+    config.range          = 64 * 1024;
+    config.stride         = 64;
+    config.access_size    = 4;
+    config.outstanding    = 4;
+    config.n_transactions = 100000;
+    
+    // Set the global time quantum, a few bank busy times
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(40, sc_core::SC_NS ));
+    
+    //! Instantiate the modules
+    traffic_generator *i_gen0 = new traffic_generator("i_gen0", config);
+    config.seed      = 2;
+    config.base_addr = 0x00008000;   // second initiator works on another region
+    traffic_generator *i_gen1 = new traffic_generator("i_gen1", config);
+    memory            *i_mem  = new memory("i_memory", false);
+    bus               *i_bus  = new bus("i_bus");
+    
+    //! Configure the memory banks
+    i_mem->timing.set_banks(n_banks, (interleave == "page") ?
+                            banked_timing::PAGE : banked_timing::CACHE_LINE);
+    
+    //! Bind  the TLM ports
+    i_gen0->data_bus.bind( i_bus->data_bus0 );
+    i_gen1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 8(banked): Simulation Complete.  #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Banks            : " << setw(10) << setfill(' ') << n_banks   <<" (" << interleave << ")    #"<<endl;
+    cout << "# Bank conflicts   : " << setw(10) << setfill(' ') << i_mem->timing.get_conflicts() <<"             #"<<endl;
+    cout << "#  - wait limited  : " << setw(10) << setfill(' ') << i_mem->timing.get_limited_conflicts() <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e9 <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+/* *****************************************************************************
+ * @file    /vp_tutorial/tlm_demo/tlm_demo9_dram/sc_main.cpp
+ * @author  vp_tutorial contributors
+ * @date    19.10.2026
+ *
+ * @brief   Main program of TLM_demo9 (DRAM timing)
+ *
+ * Usage: tlm_demo9_dram [sequential|strided|random|hotspot] [stride]
+ *
+ * Two traffic generators access the memory with the DRAM timing policy.
+ * Compare the row buffer statistics and the simulated time of the patterns.
+ *
+ * This file is part of TLM tutorials in the master course "Virtual Prototyping"
+ * given by Prof.Dr. Christoph Grimm (TU Kaiserslautern).
+ * See: https://cps.cs.uni-kl.de/lehre/virtual-prototyping/
+ * ****************************************************************************/
+
+
+#include <time.h>
+#include "../tlm_demo2/memory.h"
+#include "../tlm_demo3_sync/bus.h"
+#include "../tlm_demo6_traffic/traffic_generator.h"
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+//! main program to execute TLM_demo9
+// -----------------------------------------------------------------------------
+int sc_main(int argc, char* argv[])
+{
+    string pattern = (argc > 1) ? argv[1] : "sequential";
+    
+    traffic_config config;
+    config.pattern        = (pattern == "strided") ? PATTERN_STRIDED :
+                            (pattern == "random")  ? PATTERN_RANDOM  :
+                            (pattern == "hotspot") ? PATTERN_HOTSPOT :
+                                                     PATTERN_SEQUENTIAL;
+    config.base_addr      = 0x00000000;
+    config.range          = 1024 * 1024;
+    config.stride         = (argc > 2) ? atoll(argv[2]) : 2048;
+    config.hot_size       = 4096;
+    config.access_size    = 4;
+    config.outstanding    = 1;
+    config.n_transactions = 100000;
+    
+    // Set the global time quantum
+    tlm::tlm_global_quantum &g_quatum = tlm::tlm_global_quantum::instance();
+    g_quatum.set( sc_core::sc_time(1, sc_core::SC_US ));
+    
+    //! Instantiate the modules
+    traffic_generator *i_gen0 = new traffic_generator("i_gen0", config);
+    config.seed      = 2;
+    config.base_addr = 0x00100000;   // second initiator works on another region
+    traffic_generator *i_gen1 = new traffic_generator("i_gen1", config);
+    memory            *i_mem  = new memory("i_memory", false);
+    bus               *i_bus  = new bus("i_bus");
+    
+    //! DRAM geometry: 8 banks of 2 KB rows
+    i_mem->timing.set_geometry(8, 2048);
+    
+    //! Bind  the TLM ports
+    i_gen0->data_bus.bind( i_bus->data_bus0 );
+    i_gen1->data_bus.bind( i_bus->data_bus1 );
+    i_bus->initiator_socket.bind(i_mem->data_bus);
+    
+    int t_start=clock();
+    sc_core::sc_start();
+    int t_stop=clock();
+    
+    double t_cpu  = (t_stop-t_start)/double(CLOCKS_PER_SEC);
+    double t_sim  = sc_core::sc_time_stamp().to_seconds();
+    
+    
+    // print simulation performance
+    cout << "\n\n\n";
+    cout << "#############################################" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# TLM_demo 9(dram): Simulation Complete.    #" << endl;
+    cout << "#                                           #" << endl;
+    cout << "# Row hits         : " << setw(10) << setfill(' ') << i_mem->timing.get_row_hits()      <<"             #"<<endl;
+    cout << "# Row empty        : " << setw(10) << setfill(' ') << i_mem->timing.get_row_empty()     <<"             #"<<endl;
+    cout << "# Row conflicts    : " << setw(10) << setfill(' ') << i_mem->timing.get_row_conflicts() <<"             #"<<endl;
+    cout << "# Refresh waits    : " << setw(10) << setfill(' ') << i_mem->timing.get_refresh_waits() <<"             #"<<endl;
+    cout << "# Simulated time   : " << setw(10) << setfill(' ') << t_sim*1e9 <<" ns          #"<<endl;
+    cout << "# Elapsed CPU time : " << setw(10) << setfill(' ') << t_cpu*1e9 <<" ns          #"<< endl;
+    cout << "#                                           #" << endl;
+    cout << "#############################################" << endl;
+    return 0;
+}